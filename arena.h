@@ -0,0 +1,204 @@
+// Arena and Slab Pool Allocators
+// NutriPlan - Data Structures Project
+// Recipe steps, graph edges and tree nodes are small fixed-size records
+// that live and die together. An Arena hands out memory by bumping a
+// pointer inside large malloc'd blocks; a SlabPool layers a free list of
+// one record size on top of an arena. Dropping a whole recipe, graph or
+// tree is one reset/free of its pool instead of a free() per node.
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#define ARENA_ALIGN 8            // enough for every record in this project
+#define ARENA_DEFAULT_BLOCK 4096
+
+// Allocation statistics, kept by every arena
+typedef struct {
+    size_t allocations;    // records handed out
+    size_t frees;          // records returned one at a time (slab free list)
+    size_t bytesInUse;
+    size_t peakBytes;
+    size_t bytesReserved;  // obtained from malloc
+    size_t blocks;         // malloc calls
+    size_t resets;         // bulk releases
+} AllocStats;
+
+// Called with "block" after a new block is reserved and "reset"/"free"
+// before a bulk release
+typedef void (*AllocHook)(const char *event, const AllocStats *stats, void *data);
+
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;
+    size_t size;
+    size_t used;
+    // data follows
+} ArenaBlock;
+
+typedef struct {
+    ArenaBlock *first;
+    ArenaBlock *current;   // blocks after current are kept for reuse
+    size_t blockSize;
+    AllocStats stats;
+    AllocHook hook;
+    void *hookData;
+} Arena;
+
+typedef struct {
+    Arena arena;
+    size_t objectSize;
+    void *freeList;        // returned records, linked through their first word
+} SlabPool;
+
+static inline size_t arenaRound(size_t size) {
+    return (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+static inline char* arenaBlockData(ArenaBlock *block) {
+    return (char*)block + arenaRound(sizeof(ArenaBlock));
+}
+
+static inline void initArena(Arena *arena, size_t blockSize) {
+    memset(arena, 0, sizeof(Arena));
+    arena->blockSize = blockSize > 0 ? blockSize : ARENA_DEFAULT_BLOCK;
+}
+
+// Report to the hook, if one is set
+static inline void arenaNotify(Arena *arena, const char *event) {
+    if (arena->hook != NULL) arena->hook(event, &arena->stats, arena->hookData);
+}
+
+static inline void setAllocHook(Arena *arena, AllocHook hook, void *data) {
+    arena->hook = hook;
+    arena->hookData = data;
+}
+
+// Ready-made hook: print the statistics with data as a label
+static inline void printAllocStats(const char *event, const AllocStats *stats, void *data) {
+    printf("📦 %s %s: %zu allocs, %zu frees, %zu B in use (peak %zu), "
+           "%zu B in %zu block(s), %zu reset(s)\n",
+           data != NULL ? (const char*)data : "arena", event,
+           stats->allocations, stats->frees, stats->bytesInUse, stats->peakBytes,
+           stats->bytesReserved, stats->blocks, stats->resets);
+}
+
+// Bump-allocate size bytes
+// Returns NULL (after printing an error) if a new block cannot be reserved
+// Time Complexity: O(1) amortized
+static inline void* arenaAlloc(Arena *arena, size_t size) {
+    size = arenaRound(size);
+    ArenaBlock *block = arena->current;
+
+    // Move on to a kept block, or reserve a new one
+    while (block == NULL || block->used + size > block->size) {
+        if (block != NULL && block->next != NULL) {
+            block = block->next;
+            block->used = 0;
+            continue;
+        }
+        size_t dataSize = size > arena->blockSize ? size : arena->blockSize;
+        ArenaBlock *fresh = (ArenaBlock*)malloc(arenaRound(sizeof(ArenaBlock)) + dataSize);
+        if (fresh == NULL) {
+            printf("❌ Memory allocation failed!\n");
+            return NULL;
+        }
+        fresh->next = NULL;
+        fresh->size = dataSize;
+        fresh->used = 0;
+        if (block == NULL) arena->first = fresh;
+        else block->next = fresh;
+        block = fresh;
+        arena->stats.bytesReserved += dataSize;
+        arena->stats.blocks++;
+        arenaNotify(arena, "block");
+    }
+    arena->current = block;
+
+    void *p = arenaBlockData(block) + block->used;
+    block->used += size;
+    arena->stats.allocations++;
+    arena->stats.bytesInUse += size;
+    if (arena->stats.bytesInUse > arena->stats.peakBytes) {
+        arena->stats.peakBytes = arena->stats.bytesInUse;
+    }
+    return p;
+}
+
+// Drop every allocation but keep the blocks for reuse
+// Time Complexity: O(1)
+static inline void arenaReset(Arena *arena) {
+    arenaNotify(arena, "reset");
+    arena->current = arena->first;
+    if (arena->first != NULL) arena->first->used = 0;
+    arena->stats.bytesInUse = 0;
+    arena->stats.resets++;
+}
+
+// Return every block to malloc
+// Time Complexity: O(blocks)
+static inline void freeArena(Arena *arena) {
+    arenaNotify(arena, "free");
+    ArenaBlock *block = arena->first;
+    while (block != NULL) {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->first = arena->current = NULL;
+    arena->stats.bytesInUse = 0;
+    arena->stats.bytesReserved = 0;
+    arena->stats.resets++;
+}
+
+// ================= SLAB POOL =================
+
+static inline void initSlabPool(SlabPool *pool, size_t objectSize, size_t objectsPerBlock) {
+    if (objectSize < sizeof(void*)) objectSize = sizeof(void*);
+    pool->objectSize = arenaRound(objectSize);
+    pool->freeList = NULL;
+    initArena(&pool->arena, pool->objectSize * (objectsPerBlock > 0 ? objectsPerBlock : 64));
+}
+
+// One record, reusing a returned one first
+// Time Complexity: O(1) amortized
+static inline void* slabAlloc(SlabPool *pool) {
+    if (pool->freeList == NULL) return arenaAlloc(&pool->arena, pool->objectSize);
+
+    void *p = pool->freeList;
+    memcpy(&pool->freeList, p, sizeof(void*));
+    AllocStats *stats = &pool->arena.stats;
+    stats->allocations++;
+    stats->bytesInUse += pool->objectSize;
+    if (stats->bytesInUse > stats->peakBytes) stats->peakBytes = stats->bytesInUse;
+    return p;
+}
+
+// Return one record for reuse by this pool
+// Time Complexity: O(1)
+static inline void slabFree(SlabPool *pool, void *p) {
+    if (p == NULL) return;
+    memcpy(p, &pool->freeList, sizeof(void*));
+    pool->freeList = p;
+    pool->arena.stats.frees++;
+    pool->arena.stats.bytesInUse -= pool->objectSize;
+}
+
+// Drop every record, keeping the memory for the next load
+// Time Complexity: O(1)
+static inline void slabReset(SlabPool *pool) {
+    pool->freeList = NULL;
+    arenaReset(&pool->arena);
+}
+
+// Drop every record and give the memory back
+// Time Complexity: O(blocks)
+static inline void freeSlabPool(SlabPool *pool) {
+    pool->freeList = NULL;
+    freeArena(&pool->arena);
+}
+
+#endif
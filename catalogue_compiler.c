@@ -0,0 +1,822 @@
+// Catalogue Compiler: Data.json -> memory-mappable binary catalogue
+// NutriPlan - Data Structures Project
+// Turns foods, junkFoods, recipe steps and goal/mealTime/budget tags into
+// the columnar .npcat format (see catalogue_format.h) so programs start
+// with one mmap instead of parsing JSON and allocating per record
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "catalogue_format.h"
+
+#define MAX_STRING 4096
+#define MAX_DEPTH 64
+
+// Growable byte buffer (one per output section)
+typedef struct {
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+} ByteBuffer;
+
+// Tag dictionary: bit i <-> names[i]
+typedef struct {
+    char names[NPCAT_MAX_TAGS][32];
+    int count;
+} TagDict;
+
+typedef struct {
+    ByteBuffer sections[NPCAT_SECTION_COUNT];
+    uint32_t *stringSlots;   // open-addressing table of string offsets + 1 (0 = empty)
+    size_t slotCount;
+    size_t numStrings;
+    TagDict diets;
+    TagDict goals;
+    TagDict mealTimes;
+    TagDict budgets;
+    uint32_t numFoods;
+    uint32_t numJunkFoods;
+    uint32_t numSteps;
+    int failed;   // sticky: some append ran out of memory, the output would be misaligned
+} CatalogueBuilder;
+
+// Recursive-descent reader over the whole input buffer
+typedef struct {
+    const char *p;
+    const char *end;
+    int line;
+    int depth;
+    int failed;
+} JsonParser;
+
+// ================= OUTPUT BUFFERS =================
+
+int bufferAppend(ByteBuffer *buf, const void *data, size_t size) {
+    if (buf->size + size > buf->capacity) {
+        size_t newCapacity = buf->capacity == 0 ? 256 : buf->capacity * 2;
+        while (newCapacity < buf->size + size) newCapacity *= 2;
+        uint8_t *grown = (uint8_t*)realloc(buf->data, newCapacity);
+        if (grown == NULL) {
+            printf("❌ Out of memory\n");
+            return -1;
+        }
+        buf->data = grown;
+        buf->capacity = newCapacity;
+    }
+    memcpy(buf->data + buf->size, data, size);
+    buf->size += size;
+    return 0;
+}
+
+// Append to a section, marking the builder failed if out of memory
+void builderAppend(CatalogueBuilder *b, int section, const void *data, size_t size) {
+    if (bufferAppend(&b->sections[section], data, size) != 0) b->failed = 1;
+}
+
+void appendInt32(CatalogueBuilder *b, int section, int32_t value) {
+    builderAppend(b, section, &value, sizeof(value));
+}
+
+void appendUint32(CatalogueBuilder *b, int section, uint32_t value) {
+    builderAppend(b, section, &value, sizeof(value));
+}
+
+void appendFloat(CatalogueBuilder *b, int section, float value) {
+    builderAppend(b, section, &value, sizeof(value));
+}
+
+void appendByte(CatalogueBuilder *b, int section, uint8_t value) {
+    builderAppend(b, section, &value, sizeof(value));
+}
+
+// ================= STRING POOL =================
+
+uint32_t hashString(const char *s) {
+    uint32_t h = 2166136261u;  // FNV-1a
+    while (*s) {
+        h ^= (uint8_t)*s++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// Store a string once in the STRINGS section, returns its offset
+// Out of memory marks the builder failed and returns 0
+// Time Complexity: O(length) average
+uint32_t internString(CatalogueBuilder *b, const char *s) {
+    ByteBuffer *pool = &b->sections[NPCAT_STRINGS];
+    if (b->failed) return 0;
+
+    if ((b->numStrings + 1) * 2 > b->slotCount) {
+        size_t newCount = b->slotCount == 0 ? 256 : b->slotCount * 2;
+        uint32_t *slots = (uint32_t*)calloc(newCount, sizeof(uint32_t));
+        if (slots == NULL) {
+            printf("❌ Out of memory\n");
+            b->failed = 1;
+            return 0;
+        }
+        for (size_t i = 0; i < b->slotCount; i++) {
+            if (b->stringSlots[i] == 0) continue;
+            const char *old = (const char*)pool->data + b->stringSlots[i] - 1;
+            size_t j = hashString(old) & (newCount - 1);
+            while (slots[j] != 0) j = (j + 1) & (newCount - 1);
+            slots[j] = b->stringSlots[i];
+        }
+        free(b->stringSlots);
+        b->stringSlots = slots;
+        b->slotCount = newCount;
+    }
+
+    size_t j = hashString(s) & (b->slotCount - 1);
+    while (b->stringSlots[j] != 0) {
+        uint32_t offset = b->stringSlots[j] - 1;
+        if (strcmp((const char*)pool->data + offset, s) == 0) return offset;
+        j = (j + 1) & (b->slotCount - 1);
+    }
+
+    uint32_t offset = (uint32_t)pool->size;
+    if (bufferAppend(pool, s, strlen(s) + 1) != 0) {
+        b->failed = 1;
+        return 0;
+    }
+    b->stringSlots[j] = offset + 1;
+    b->numStrings++;
+    return offset;
+}
+
+// Index of a tag name in its dictionary, adding it if new (-1 if full)
+int tagIndex(TagDict *dict, const char *name) {
+    for (int i = 0; i < dict->count; i++) {
+        if (strcmp(dict->names[i], name) == 0) return i;
+    }
+    if (dict->count >= NPCAT_MAX_TAGS) {
+        printf("❌ Too many distinct tags (max %d): %s\n", NPCAT_MAX_TAGS, name);
+        return -1;
+    }
+    snprintf(dict->names[dict->count], sizeof(dict->names[0]), "%s", name);
+    return dict->count++;
+}
+
+// ================= JSON READER =================
+
+void parseError(JsonParser *p, const char *message) {
+    if (!p->failed) printf("❌ Data.json line %d: %s\n", p->line, message);
+    p->failed = 1;
+}
+
+void skipWhitespace(JsonParser *p) {
+    while (p->p < p->end && (*p->p == ' ' || *p->p == '\t' || *p->p == '\r' || *p->p == '\n')) {
+        if (*p->p == '\n') p->line++;
+        p->p++;
+    }
+}
+
+// Consume ch (after whitespace); returns 1 if it was there
+int consume(JsonParser *p, char ch) {
+    skipWhitespace(p);
+    if (p->p < p->end && *p->p == ch) {
+        p->p++;
+        return 1;
+    }
+    return 0;
+}
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Append a code point as UTF-8
+int putUtf8(char *out, int len, int outSize, uint32_t cp) {
+    char tmp[4];
+    int n;
+    if (cp < 0x80) { tmp[0] = (char)cp; n = 1; }
+    else if (cp < 0x800) { tmp[0] = (char)(0xC0 | (cp >> 6)); tmp[1] = (char)(0x80 | (cp & 0x3F)); n = 2; }
+    else if (cp < 0x10000) {
+        tmp[0] = (char)(0xE0 | (cp >> 12)); tmp[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        tmp[2] = (char)(0x80 | (cp & 0x3F)); n = 3;
+    } else {
+        tmp[0] = (char)(0xF0 | (cp >> 18)); tmp[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+        tmp[2] = (char)(0x80 | ((cp >> 6) & 0x3F)); tmp[3] = (char)(0x80 | (cp & 0x3F)); n = 4;
+    }
+    if (len + n >= outSize) return -1;
+    memcpy(out + len, tmp, n);
+    return len + n;
+}
+
+uint32_t readHex4(JsonParser *p) {
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++) {
+        int h = p->p < p->end ? hexValue(*p->p) : -1;
+        if (h < 0) {
+            parseError(p, "bad \\u escape");
+            return 0;
+        }
+        value = value * 16 + (uint32_t)h;
+        p->p++;
+    }
+    return value;
+}
+
+// Parse a JSON string into out (decoding escapes)
+int parseString(JsonParser *p, char *out, int outSize) {
+    if (!consume(p, '"')) {
+        parseError(p, "expected string");
+        return -1;
+    }
+    int len = 0;
+    while (p->p < p->end && *p->p != '"') {
+        char c = *p->p++;
+        if (c == '\\') {
+            if (p->p >= p->end) break;
+            char e = *p->p++;
+            uint32_t cp;
+            switch (e) {
+                case 'n': cp = '\n'; break;
+                case 't': cp = '\t'; break;
+                case 'r': cp = '\r'; break;
+                case 'b': cp = '\b'; break;
+                case 'f': cp = '\f'; break;
+                case 'u':
+                    cp = readHex4(p);
+                    if (cp >= 0xD800 && cp < 0xDC00 && p->end - p->p >= 6 &&
+                        p->p[0] == '\\' && p->p[1] == 'u') {
+                        p->p += 2;
+                        uint32_t low = readHex4(p);
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    break;
+                default: cp = (uint8_t)e; break;  // \" \\ \/
+            }
+            len = putUtf8(out, len, outSize, cp);
+        } else {
+            if (c == '\n') p->line++;
+            len = len + 1 < outSize ? (out[len] = c, len + 1) : -1;
+        }
+        if (len < 0) {
+            parseError(p, "string too long");
+            return -1;
+        }
+    }
+    if (p->p >= p->end) {
+        parseError(p, "unterminated string");
+        return -1;
+    }
+    p->p++;
+    out[len] = '\0';
+    return len;
+}
+
+double parseNumber(JsonParser *p) {
+    skipWhitespace(p);
+    char *endPtr;
+    double value = strtod(p->p, &endPtr);
+    if (endPtr == p->p) parseError(p, "expected number");
+    p->p = endPtr;
+    return value;
+}
+
+// Skip any value (used for keys the catalogue does not store)
+void skipValue(JsonParser *p) {
+    char scratch[MAX_STRING];
+    skipWhitespace(p);
+    if (p->p >= p->end) {
+        parseError(p, "unexpected end of file");
+        return;
+    }
+    char c = *p->p;
+    if (c == '"') {
+        parseString(p, scratch, sizeof(scratch));
+    } else if (c == '{' || c == '[') {
+        char close = c == '{' ? '}' : ']';
+        if (++p->depth > MAX_DEPTH) {
+            parseError(p, "nesting too deep");
+            return;
+        }
+        p->p++;
+        if (!consume(p, close)) {
+            do {
+                if (c == '{') {
+                    parseString(p, scratch, sizeof(scratch));
+                    if (!consume(p, ':')) parseError(p, "expected ':'");
+                }
+                skipValue(p);
+            } while (!p->failed && consume(p, ','));
+            if (!consume(p, close)) parseError(p, "unbalanced brackets");
+        }
+        p->depth--;
+    } else if (c == 't' || c == 'f' || c == 'n') {
+        while (p->p < p->end && *p->p >= 'a' && *p->p <= 'z') p->p++;
+    } else {
+        parseNumber(p);
+    }
+}
+
+// Parse ["a", "b", ...] into a tag bitmask
+uint8_t parseTagArray(JsonParser *p, TagDict *dict) {
+    char tag[MAX_STRING];
+    uint8_t mask = 0;
+    if (!consume(p, '[')) {
+        parseError(p, "expected tag array");
+        return 0;
+    }
+    if (consume(p, ']')) return 0;
+    do {
+        if (parseString(p, tag, sizeof(tag)) < 0) return 0;
+        int bit = tagIndex(dict, tag);
+        if (bit < 0) {
+            parseError(p, "tag dictionary full");
+            return 0;
+        }
+        mask |= (uint8_t)(1u << bit);
+    } while (consume(p, ','));
+    if (!consume(p, ']')) parseError(p, "expected ']'");
+    return mask;
+}
+
+// Parse one entry of "foods" and append it to every food column
+void parseFood(JsonParser *p, CatalogueBuilder *b) {
+    char key[64], text[MAX_STRING];
+    int32_t id = 0, calories = 0, cost = 0, cookTime = 0;
+    float protein = 0, carbs = 0, fats = 0;
+    uint32_t name = internString(b, ""), hindiName = name, icon = name, category = name;
+    int diet = -1;  // required: there is no safe default diet
+    uint8_t goals = 0, mealTimes = 0, budgets = 0;
+
+    appendUint32(b, NPCAT_FOOD_STEP_START, b->numSteps);
+
+    if (!consume(p, '{')) {
+        parseError(p, "expected food object");
+        return;
+    }
+    if (!consume(p, '}')) {
+        do {
+            if (parseString(p, key, sizeof(key)) < 0 || !consume(p, ':')) {
+                parseError(p, "expected key");
+                return;
+            }
+            if (strcmp(key, "id") == 0) id = (int32_t)parseNumber(p);
+            else if (strcmp(key, "calories") == 0) calories = (int32_t)parseNumber(p);
+            else if (strcmp(key, "cost") == 0) cost = (int32_t)parseNumber(p);
+            else if (strcmp(key, "cookTime") == 0) cookTime = (int32_t)parseNumber(p);
+            else if (strcmp(key, "protein") == 0) protein = (float)parseNumber(p);
+            else if (strcmp(key, "carbs") == 0) carbs = (float)parseNumber(p);
+            else if (strcmp(key, "fats") == 0) fats = (float)parseNumber(p);
+            else if (strcmp(key, "goal") == 0) goals = parseTagArray(p, &b->goals);
+            else if (strcmp(key, "mealTime") == 0) mealTimes = parseTagArray(p, &b->mealTimes);
+            else if (strcmp(key, "budget") == 0) budgets = parseTagArray(p, &b->budgets);
+            else if (strcmp(key, "steps") == 0) {
+                if (!consume(p, '[')) parseError(p, "expected steps array");
+                else if (!consume(p, ']')) {
+                    do {
+                        if (parseString(p, text, sizeof(text)) < 0) return;
+                        appendUint32(b, NPCAT_STEPS, internString(b, text));
+                        b->numSteps++;
+                    } while (consume(p, ','));
+                    if (!consume(p, ']')) parseError(p, "expected ']'");
+                }
+            } else if (strcmp(key, "name") == 0 || strcmp(key, "hindiName") == 0 ||
+                       strcmp(key, "icon") == 0 || strcmp(key, "category") == 0 ||
+                       strcmp(key, "dietType") == 0) {
+                if (parseString(p, text, sizeof(text)) < 0) return;
+                if (key[0] == 'n') name = internString(b, text);
+                else if (key[0] == 'h') hindiName = internString(b, text);
+                else if (key[0] == 'i') icon = internString(b, text);
+                else if (key[0] == 'c') category = internString(b, text);
+                else {
+                    diet = tagIndex(&b->diets, text);
+                    if (diet < 0) parseError(p, "diet dictionary full");
+                }
+            } else {
+                skipValue(p);
+            }
+        } while (!p->failed && consume(p, ','));
+        if (!consume(p, '}')) parseError(p, "expected '}' after food");
+    }
+    if (diet < 0) {
+        parseError(p, "food has no dietType");
+        return;
+    }
+
+    appendInt32(b, NPCAT_FOOD_ID, id);
+    appendUint32(b, NPCAT_FOOD_NAME, name);
+    appendUint32(b, NPCAT_FOOD_HINDI_NAME, hindiName);
+    appendUint32(b, NPCAT_FOOD_ICON, icon);
+    appendUint32(b, NPCAT_FOOD_CATEGORY, category);
+    appendInt32(b, NPCAT_FOOD_CALORIES, calories);
+    appendFloat(b, NPCAT_FOOD_PROTEIN, protein);
+    appendFloat(b, NPCAT_FOOD_CARBS, carbs);
+    appendFloat(b, NPCAT_FOOD_FATS, fats);
+    appendInt32(b, NPCAT_FOOD_COST, cost);
+    appendInt32(b, NPCAT_FOOD_COOK_TIME, cookTime);
+    appendByte(b, NPCAT_FOOD_DIET, (uint8_t)diet);
+    appendByte(b, NPCAT_FOOD_GOALS, goals);
+    appendByte(b, NPCAT_FOOD_MEAL_TIMES, mealTimes);
+    appendByte(b, NPCAT_FOOD_BUDGETS, budgets);
+    b->numFoods++;
+}
+
+// Parse one entry of "junkFoods"
+void parseJunkFood(JsonParser *p, CatalogueBuilder *b) {
+    char key[64], text[MAX_STRING];
+    int32_t id = 0, calories = 0;
+    uint32_t name = internString(b, ""), icon = name;
+
+    if (!consume(p, '{')) {
+        parseError(p, "expected junk food object");
+        return;
+    }
+    if (!consume(p, '}')) {
+        do {
+            if (parseString(p, key, sizeof(key)) < 0 || !consume(p, ':')) {
+                parseError(p, "expected key");
+                return;
+            }
+            if (strcmp(key, "id") == 0) id = (int32_t)parseNumber(p);
+            else if (strcmp(key, "calories") == 0) calories = (int32_t)parseNumber(p);
+            else if (strcmp(key, "name") == 0 || strcmp(key, "icon") == 0) {
+                if (parseString(p, text, sizeof(text)) < 0) return;
+                if (key[0] == 'n') name = internString(b, text);
+                else icon = internString(b, text);
+            } else {
+                skipValue(p);
+            }
+        } while (!p->failed && consume(p, ','));
+        if (!consume(p, '}')) parseError(p, "expected '}' after junk food");
+    }
+
+    appendInt32(b, NPCAT_JUNK_ID, id);
+    appendUint32(b, NPCAT_JUNK_NAME, name);
+    appendUint32(b, NPCAT_JUNK_ICON, icon);
+    appendInt32(b, NPCAT_JUNK_CALORIES, calories);
+    b->numJunkFoods++;
+}
+
+// Parse the top-level object: { "foods": [...], "junkFoods": [...] }
+// Time Complexity: O(file size)
+int parseCatalogue(JsonParser *p, CatalogueBuilder *b) {
+    char key[64];
+    if (!consume(p, '{')) {
+        parseError(p, "expected top-level object");
+        return -1;
+    }
+    if (!consume(p, '}')) {
+        do {
+            if (parseString(p, key, sizeof(key)) < 0 || !consume(p, ':')) {
+                parseError(p, "expected key");
+                break;
+            }
+            int isFoods = strcmp(key, "foods") == 0;
+            int isJunk = strcmp(key, "junkFoods") == 0;
+            if (!isFoods && !isJunk) {
+                skipValue(p);
+                continue;
+            }
+            if (!consume(p, '[')) {
+                parseError(p, "expected array");
+                break;
+            }
+            if (consume(p, ']')) continue;
+            do {
+                if (isFoods) parseFood(p, b);
+                else parseJunkFood(p, b);
+            } while (!p->failed && consume(p, ','));
+            if (!consume(p, ']')) parseError(p, "expected ']'");
+        } while (!p->failed && consume(p, ','));
+        if (!consume(p, '}')) parseError(p, "expected '}' at end of file");
+    }
+    appendUint32(b, NPCAT_FOOD_STEP_START, b->numSteps);  // end of the last food's steps
+    return p->failed ? -1 : 0;
+}
+
+// ================= WRITER =================
+
+void storeTagNames(CatalogueBuilder *b, int section, const TagDict *dict) {
+    for (int i = 0; i < dict->count; i++) {
+        appendUint32(b, section, internString(b, dict->names[i]));
+    }
+}
+
+size_t alignUp(size_t value) {
+    return (value + NPCAT_ALIGN - 1) / NPCAT_ALIGN * NPCAT_ALIGN;
+}
+
+// Write header + 64-byte aligned sections; writes to a temp file and renames
+// so processes that already mapped the old catalogue keep a consistent view
+int writeCatalogue(CatalogueBuilder *b, const char *path) {
+    internString(b, "");  // STRINGS is never empty, so it always ends in NUL
+    storeTagNames(b, NPCAT_DIET_NAMES, &b->diets);
+    storeTagNames(b, NPCAT_GOAL_NAMES, &b->goals);
+    storeTagNames(b, NPCAT_MEAL_TIME_NAMES, &b->mealTimes);
+    storeTagNames(b, NPCAT_BUDGET_NAMES, &b->budgets);
+    if (b->failed) {
+        printf("❌ Ran out of memory building the catalogue, %s not written\n", path);
+        return -1;
+    }
+
+    NpcatHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, NPCAT_MAGIC, 8);
+    header.version = NPCAT_VERSION;
+    header.headerSize = sizeof(NpcatHeader);
+    header.numFoods = b->numFoods;
+    header.numJunkFoods = b->numJunkFoods;
+    header.numSteps = b->numSteps;
+    header.numDietTypes = (uint32_t)b->diets.count;
+    header.numGoals = (uint32_t)b->goals.count;
+    header.numMealTimes = (uint32_t)b->mealTimes.count;
+    header.numBudgets = (uint32_t)b->budgets.count;
+
+    size_t offset = alignUp(sizeof(NpcatHeader));
+    for (int i = 0; i < NPCAT_SECTION_COUNT; i++) {
+        header.sections[i].offset = offset;
+        header.sections[i].size = b->sections[i].size;
+        offset = alignUp(offset + b->sections[i].size);
+    }
+    header.fileSize = offset;
+
+    char tmpPath[512];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+    FILE *fp = fopen(tmpPath, "wb");
+    if (fp == NULL) {
+        printf("❌ Cannot write %s\n", tmpPath);
+        return -1;
+    }
+
+    static const uint8_t zeros[NPCAT_ALIGN] = {0};
+    size_t written = fwrite(&header, 1, sizeof(header), fp);
+    size_t position = sizeof(header);
+    for (int i = 0; i < NPCAT_SECTION_COUNT; i++) {
+        written += fwrite(zeros, 1, header.sections[i].offset - position, fp);
+        written += fwrite(b->sections[i].data, 1, b->sections[i].size, fp);
+        position = header.sections[i].offset + b->sections[i].size;
+    }
+    written += fwrite(zeros, 1, header.fileSize - position, fp);
+
+    if (fclose(fp) != 0 || written != header.fileSize || rename(tmpPath, path) != 0) {
+        printf("❌ Failed writing %s\n", path);
+        remove(tmpPath);
+        return -1;
+    }
+    return 0;
+}
+
+void freeBuilder(CatalogueBuilder *b) {
+    for (int i = 0; i < NPCAT_SECTION_COUNT; i++) free(b->sections[i].data);
+    free(b->stringSlots);
+    memset(b, 0, sizeof(CatalogueBuilder));
+}
+
+// Compile a Data.json-shaped file into a catalogue
+int compileCatalogue(const char *jsonPath, const char *outPath) {
+    FILE *fp = fopen(jsonPath, "rb");
+    if (fp == NULL) {
+        printf("❌ Cannot open %s\n", jsonPath);
+        return -1;
+    }
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *json = (char*)malloc((size_t)size + 1);
+    if (json == NULL || fread(json, 1, (size_t)size, fp) != (size_t)size) {
+        printf("❌ Cannot read %s\n", jsonPath);
+        fclose(fp);
+        free(json);
+        return -1;
+    }
+    fclose(fp);
+    json[size] = '\0';
+
+    CatalogueBuilder builder;
+    memset(&builder, 0, sizeof(builder));
+    JsonParser parser = { json, json + size, 1, 0, 0 };
+
+    int result = parseCatalogue(&parser, &builder);
+    if (result == 0) result = writeCatalogue(&builder, outPath);
+
+    free(json);
+    freeBuilder(&builder);
+    return result;
+}
+
+// ================= DEMO: READ THE MAPPED CATALOGUE =================
+
+void printTagMask(const NpcatFile *cat, int namesSection, uint8_t mask) {
+    int first = 1;
+    for (int bit = 0; bit < NPCAT_MAX_TAGS; bit++) {
+        if (mask & (1u << bit)) {
+            printf("%s%s", first ? "" : ", ", npcatText(cat, namesSection, (uint32_t)bit));
+            first = 0;
+        }
+    }
+}
+
+void printFood(const NpcatFile *cat, uint32_t row) {
+    const int32_t *calories = (const int32_t*)npcatSection(cat, NPCAT_FOOD_CALORIES);
+    const float *protein = (const float*)npcatSection(cat, NPCAT_FOOD_PROTEIN);
+    const int32_t *cost = (const int32_t*)npcatSection(cat, NPCAT_FOOD_COST);
+    const uint8_t *diet = (const uint8_t*)npcatSection(cat, NPCAT_FOOD_DIET);
+    const uint8_t *goals = (const uint8_t*)npcatSection(cat, NPCAT_FOOD_GOALS);
+    const uint8_t *mealTimes = (const uint8_t*)npcatSection(cat, NPCAT_FOOD_MEAL_TIMES);
+    const uint8_t *budgets = (const uint8_t*)npcatSection(cat, NPCAT_FOOD_BUDGETS);
+    const uint32_t *stepStart = (const uint32_t*)npcatSection(cat, NPCAT_FOOD_STEP_START);
+
+    printf("%s %s (%s)\n", npcatText(cat, NPCAT_FOOD_ICON, row),
+           npcatText(cat, NPCAT_FOOD_NAME, row), npcatText(cat, NPCAT_FOOD_HINDI_NAME, row));
+    printf("  • %d kcal | %.1fg protein | Rs.%d | %s\n", calories[row], protein[row],
+           cost[row], npcatText(cat, NPCAT_DIET_NAMES, diet[row]));
+    printf("  • goal: ");
+    printTagMask(cat, NPCAT_GOAL_NAMES, goals[row]);
+    printf(" | mealTime: ");
+    printTagMask(cat, NPCAT_MEAL_TIME_NAMES, mealTimes[row]);
+    printf(" | budget: ");
+    printTagMask(cat, NPCAT_BUDGET_NAMES, budgets[row]);
+    printf("\n");
+    for (uint32_t s = stepStart[row]; s < stepStart[row + 1]; s++) {
+        printf("    %u. %s\n", s - stepStart[row] + 1, npcatText(cat, NPCAT_STEPS, s));
+    }
+}
+
+// ================= CORRUPT-FILE TEST =================
+
+// Write size bytes of data to path
+int writeBytes(const char *path, const void *data, size_t size) {
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL) return -1;
+    size_t written = fwrite(data, 1, size, fp);
+    return fclose(fp) == 0 && written == size ? 0 : -1;
+}
+
+// Damage a copy of a good catalogue in one way and check npcatOpen
+// rejects it. Returns 1 if it was rejected
+int rejectsCorruption(const char *label, const uint8_t *good, size_t size, const char *path,
+                      void (*damage)(uint8_t *copy, size_t *size)) {
+    uint8_t *copy = (uint8_t*)malloc(size);
+    if (copy == NULL) return 0;
+    memcpy(copy, good, size);
+    size_t newSize = size;
+    damage(copy, &newSize);
+    NpcatFile cat;
+    int rejected = writeBytes(path, copy, newSize) == 0 && npcatOpen(path, &cat) != 0;
+    if (!rejected) npcatClose(&cat);
+    printf("%s %s\n", rejected ? "✅ rejected:" : "❌ accepted:", label);
+    free(copy);
+    return rejected;
+}
+
+static inline NpcatHeader* headerOf(uint8_t *copy) {
+    return (NpcatHeader*)copy;
+}
+
+static inline uint8_t* sectionOf(uint8_t *copy, int section) {
+    return copy + headerOf(copy)->sections[section].offset;
+}
+
+void truncateFile(uint8_t *copy, size_t *size) {
+    (void)copy;
+    *size -= NPCAT_ALIGN;
+}
+
+void extraFood(uint8_t *copy, size_t *size) {
+    (void)size;
+    headerOf(copy)->numFoods++;
+}
+
+void nameOffsetPastPool(uint8_t *copy, size_t *size) {
+    (void)size;
+    uint32_t past = (uint32_t)headerOf(copy)->sections[NPCAT_STRINGS].size;
+    memcpy(sectionOf(copy, NPCAT_FOOD_NAME), &past, sizeof(past));
+}
+
+void unterminatedStrings(uint8_t *copy, size_t *size) {
+    (void)size;
+    const NpcatSection *strings = &headerOf(copy)->sections[NPCAT_STRINGS];
+    copy[strings->offset + strings->size - 1] = 'x';
+}
+
+void dietOutOfRange(uint8_t *copy, size_t *size) {
+    (void)size;
+    sectionOf(copy, NPCAT_FOOD_DIET)[0] = (uint8_t)headerOf(copy)->numDietTypes;
+}
+
+void goalBitOutOfRange(uint8_t *copy, size_t *size) {
+    (void)size;
+    sectionOf(copy, NPCAT_FOOD_GOALS)[0] |= 0x80;  // Data.json has fewer than 8 goals
+}
+
+void tooManyGoals(uint8_t *copy, size_t *size) {
+    (void)size;
+    headerOf(copy)->numGoals = NPCAT_MAX_TAGS + 1;
+}
+
+void stepRangeBackwards(uint8_t *copy, size_t *size) {
+    (void)size;
+    uint32_t *stepStart = (uint32_t*)sectionOf(copy, NPCAT_FOOD_STEP_START);
+    stepStart[1] = headerOf(copy)->numSteps + 1;
+}
+
+// Every damaged copy of path must be refused, and a food without a
+// dietType must not compile
+int corruptFileTest(const char *path) {
+    printf("=== CORRUPT-FILE TEST ===\n");
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) return 0;
+    fseek(fp, 0, SEEK_END);
+    size_t size = (size_t)ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    uint8_t *good = (uint8_t*)malloc(size);
+    int ok = good != NULL && fread(good, 1, size, fp) == size;
+    fclose(fp);
+    if (!ok) {
+        free(good);
+        return 0;
+    }
+
+    char damaged[512];
+    snprintf(damaged, sizeof(damaged), "%s.corrupt", path);
+    ok &= rejectsCorruption("file cut short", good, size, damaged, truncateFile);
+    ok &= rejectsCorruption("food count larger than the columns", good, size, damaged, extraFood);
+    ok &= rejectsCorruption("name offset past the string pool", good, size, damaged, nameOffsetPastPool);
+    ok &= rejectsCorruption("string pool without final NUL", good, size, damaged, unterminatedStrings);
+    ok &= rejectsCorruption("diet code past the diet names", good, size, damaged, dietOutOfRange);
+    ok &= rejectsCorruption("goal bit past the goal names", good, size, damaged, goalBitOutOfRange);
+    ok &= rejectsCorruption("more goals than NPCAT_MAX_TAGS", good, size, damaged, tooManyGoals);
+    ok &= rejectsCorruption("step range running backwards", good, size, damaged, stepRangeBackwards);
+    remove(damaged);
+    free(good);
+
+    char noDietOut[512];
+    snprintf(damaged, sizeof(damaged), "%s.nodiet.json", path);
+    snprintf(noDietOut, sizeof(noDietOut), "%s.nodiet", path);
+    const char *noDiet = "{ \"foods\": [ { \"id\": 1, \"name\": \"Poha\", \"calories\": 250 } ] }";
+    int compiled = writeBytes(damaged, noDiet, strlen(noDiet)) == 0 &&
+                   compileCatalogue(damaged, noDietOut) == 0;
+    printf("%s food without dietType\n", compiled ? "❌ compiled:" : "✅ rejected:");
+    ok &= !compiled;
+    remove(damaged);
+    remove(noDietOut);
+    printf("\n");
+    return ok;
+}
+
+// Usage: catalogue_compiler [Data.json] [catalogue.npcat]
+int main(int argc, char **argv) {
+    const char *jsonPath = argc > 1 ? argv[1] : "Data.json";
+    const char *outPath = argc > 2 ? argv[2] : "catalogue.npcat";
+
+    printf("\n=== NutriPlan Catalogue Compiler (Data.json -> .npcat) ===\n\n");
+
+    clock_t start = clock();
+    if (compileCatalogue(jsonPath, outPath) != 0) return 1;
+    double compileMs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+    start = clock();
+    NpcatFile cat;
+    if (npcatOpen(outPath, &cat) != 0) return 1;
+    double openMs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+    const NpcatHeader *h = cat.header;
+    printf("✅ Compiled %s -> %s (%llu bytes) in %.2f ms\n", jsonPath, outPath,
+           (unsigned long long)h->fileSize, compileMs);
+    printf("✅ Mapped in %.3f ms: %u foods, %u junk foods, %u recipe steps\n",
+           openMs, h->numFoods, h->numJunkFoods, h->numSteps);
+    printf("   Tags: %u diet types, %u goals, %u meal times, %u budgets, %llu bytes of strings\n\n",
+           h->numDietTypes, h->numGoals, h->numMealTimes, h->numBudgets,
+           (unsigned long long)h->sections[NPCAT_STRINGS].size);
+
+    printf("--- FIRST FOODS ---\n");
+    for (uint32_t row = 0; row < h->numFoods && row < 2; row++) printFood(&cat, row);
+
+    printf("\n--- WEIGHT LOSS, MORNING, LOW BUDGET (bitmask filter) ---\n");
+    int goal = npcatTagIndex(&cat, NPCAT_GOAL_NAMES, "weight-loss");
+    int time = npcatTagIndex(&cat, NPCAT_MEAL_TIME_NAMES, "morning");
+    int budget = npcatTagIndex(&cat, NPCAT_BUDGET_NAMES, "low");
+    const uint8_t *goals = (const uint8_t*)npcatSection(&cat, NPCAT_FOOD_GOALS);
+    const uint8_t *mealTimes = (const uint8_t*)npcatSection(&cat, NPCAT_FOOD_MEAL_TIMES);
+    const uint8_t *budgets = (const uint8_t*)npcatSection(&cat, NPCAT_FOOD_BUDGETS);
+    const int32_t *calories = (const int32_t*)npcatSection(&cat, NPCAT_FOOD_CALORIES);
+    if (goal >= 0 && time >= 0 && budget >= 0) {
+        for (uint32_t row = 0; row < h->numFoods; row++) {
+            if ((goals[row] >> goal & 1) && (mealTimes[row] >> time & 1) && (budgets[row] >> budget & 1)) {
+                printf("  %-25s %d kcal\n", npcatText(&cat, NPCAT_FOOD_NAME, row), calories[row]);
+            }
+        }
+    }
+
+    printf("\n--- JUNK FOODS ---\n");
+    const int32_t *junkCalories = (const int32_t*)npcatSection(&cat, NPCAT_JUNK_CALORIES);
+    for (uint32_t row = 0; row < h->numJunkFoods; row++) {
+        printf("  %s %-20s %d kcal\n", npcatText(&cat, NPCAT_JUNK_ICON, row),
+               npcatText(&cat, NPCAT_JUNK_NAME, row), junkCalories[row]);
+    }
+
+    npcatClose(&cat);
+    printf("\n");
+    int passed = corruptFileTest(outPath);
+    printf("=== Catalogue ready: every worker can mmap %s read-only ===\n\n", outPath);
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,235 @@
+// Binary Food Catalogue Format (.npcat)
+// NutriPlan - Data Structures Project
+// On-disk layout written by catalogue_compiler.c from Data.json and read
+// by any program with a single read-only mmap (no parsing, no allocation)
+//
+// File = header, then sections aligned to 64 bytes. Every section is a
+// plain array; strings are uint32 offsets into the STRINGS section, which
+// holds NUL-terminated UTF-8. Tag columns (goal/mealTime/budget) are
+// bitmasks whose bit i means the i-th name in the matching *_NAMES section.
+// All integers are little-endian.
+
+#ifndef CATALOGUE_FORMAT_H
+#define CATALOGUE_FORMAT_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define NPCAT_MAGIC "NPCAT\0\0\0"
+#define NPCAT_VERSION 1
+#define NPCAT_ALIGN 64
+#define NPCAT_MAX_TAGS 8   // tag bitmasks are one byte
+
+// Section ids (the order of the section table in the header)
+enum {
+    NPCAT_FOOD_ID,          // int32[numFoods]
+    NPCAT_FOOD_NAME,        // uint32[numFoods] string offsets
+    NPCAT_FOOD_HINDI_NAME,  // uint32[numFoods]
+    NPCAT_FOOD_ICON,        // uint32[numFoods]
+    NPCAT_FOOD_CATEGORY,    // uint32[numFoods]
+    NPCAT_FOOD_CALORIES,    // int32[numFoods]
+    NPCAT_FOOD_PROTEIN,     // float[numFoods]
+    NPCAT_FOOD_CARBS,       // float[numFoods]
+    NPCAT_FOOD_FATS,        // float[numFoods]
+    NPCAT_FOOD_COST,        // int32[numFoods]
+    NPCAT_FOOD_COOK_TIME,   // int32[numFoods]
+    NPCAT_FOOD_DIET,        // uint8[numFoods] index into DIET_NAMES
+    NPCAT_FOOD_GOALS,       // uint8[numFoods] bitmask over GOAL_NAMES
+    NPCAT_FOOD_MEAL_TIMES,  // uint8[numFoods] bitmask over MEAL_TIME_NAMES
+    NPCAT_FOOD_BUDGETS,     // uint8[numFoods] bitmask over BUDGET_NAMES
+    NPCAT_FOOD_STEP_START,  // uint32[numFoods + 1] ranges into STEPS
+    NPCAT_STEPS,            // uint32[numSteps] string offsets
+    NPCAT_JUNK_ID,          // int32[numJunkFoods]
+    NPCAT_JUNK_NAME,        // uint32[numJunkFoods]
+    NPCAT_JUNK_ICON,        // uint32[numJunkFoods]
+    NPCAT_JUNK_CALORIES,    // int32[numJunkFoods]
+    NPCAT_DIET_NAMES,       // uint32[numDietTypes]
+    NPCAT_GOAL_NAMES,       // uint32[numGoals]
+    NPCAT_MEAL_TIME_NAMES,  // uint32[numMealTimes]
+    NPCAT_BUDGET_NAMES,     // uint32[numBudgets]
+    NPCAT_STRINGS,          // char[]
+    NPCAT_SECTION_COUNT
+};
+
+typedef struct {
+    uint64_t offset;  // from start of file, multiple of NPCAT_ALIGN
+    uint64_t size;    // in bytes
+} NpcatSection;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t headerSize;
+    uint64_t fileSize;
+    uint32_t numFoods;
+    uint32_t numJunkFoods;
+    uint32_t numSteps;
+    uint32_t numDietTypes;
+    uint32_t numGoals;
+    uint32_t numMealTimes;
+    uint32_t numBudgets;
+    uint32_t reserved;
+    NpcatSection sections[NPCAT_SECTION_COUNT];
+} NpcatHeader;
+
+// Read-only view of a mapped catalogue
+typedef struct {
+    const uint8_t *base;
+    size_t size;
+    const NpcatHeader *header;
+} NpcatFile;
+
+// Expected size in bytes of a section, from the header's counts
+static inline uint64_t npcatExpectedSize(const NpcatHeader *h, int section) {
+    switch (section) {
+        case NPCAT_FOOD_DIET: case NPCAT_FOOD_GOALS:
+        case NPCAT_FOOD_MEAL_TIMES: case NPCAT_FOOD_BUDGETS: return h->numFoods;
+        case NPCAT_FOOD_STEP_START: return ((uint64_t)h->numFoods + 1) * 4;
+        case NPCAT_STEPS: return (uint64_t)h->numSteps * 4;
+        case NPCAT_JUNK_ID: case NPCAT_JUNK_NAME:
+        case NPCAT_JUNK_ICON: case NPCAT_JUNK_CALORIES: return (uint64_t)h->numJunkFoods * 4;
+        case NPCAT_DIET_NAMES: return (uint64_t)h->numDietTypes * 4;
+        case NPCAT_GOAL_NAMES: return (uint64_t)h->numGoals * 4;
+        case NPCAT_MEAL_TIME_NAMES: return (uint64_t)h->numMealTimes * 4;
+        case NPCAT_BUDGET_NAMES: return (uint64_t)h->numBudgets * 4;
+        default: return (uint64_t)h->numFoods * 4;  // the 4-byte food columns
+    }
+}
+
+// Every string offset of a column lands inside STRINGS
+static inline int npcatOffsetsValid(const uint8_t *base, const NpcatHeader *h, int section) {
+    const uint32_t *offsets = (const uint32_t*)(base + h->sections[section].offset);
+    uint64_t count = h->sections[section].size / 4;
+    for (uint64_t i = 0; i < count; i++) {
+        if (offsets[i] >= h->sections[NPCAT_STRINGS].size) return 0;
+    }
+    return 1;
+}
+
+// Check everything consumers index without further checks: section
+// sizes against the counts, tag counts, per-food diet codes and tag
+// bits, step ranges and string offsets
+// Returns NULL if the catalogue is consistent, otherwise what is wrong
+// Time Complexity: O(foods + steps + junk foods)
+static inline const char* npcatValidate(const uint8_t *base, const NpcatHeader *h) {
+    if (h->numDietTypes > NPCAT_MAX_TAGS || h->numGoals > NPCAT_MAX_TAGS ||
+        h->numMealTimes > NPCAT_MAX_TAGS || h->numBudgets > NPCAT_MAX_TAGS) {
+        return "too many tag names";
+    }
+    for (int i = 0; i < NPCAT_SECTION_COUNT; i++) {
+        const NpcatSection *s = &h->sections[i];
+        if (s->offset % NPCAT_ALIGN != 0 || s->offset < sizeof(NpcatHeader) ||
+            s->offset > h->fileSize || s->size > h->fileSize - s->offset) {
+            return "section outside the file";
+        }
+        if (i != NPCAT_STRINGS && s->size != npcatExpectedSize(h, i)) return "section size does not match its count";
+    }
+
+    // STRINGS must end in NUL so every in-range offset is a terminated string
+    const NpcatSection *strings = &h->sections[NPCAT_STRINGS];
+    if (strings->size == 0 || base[strings->offset + strings->size - 1] != '\0') return "string pool not terminated";
+    static const int stringColumns[] = {
+        NPCAT_FOOD_NAME, NPCAT_FOOD_HINDI_NAME, NPCAT_FOOD_ICON, NPCAT_FOOD_CATEGORY, NPCAT_STEPS,
+        NPCAT_JUNK_NAME, NPCAT_JUNK_ICON, NPCAT_DIET_NAMES, NPCAT_GOAL_NAMES, NPCAT_MEAL_TIME_NAMES,
+        NPCAT_BUDGET_NAMES
+    };
+    for (size_t c = 0; c < sizeof(stringColumns) / sizeof(stringColumns[0]); c++) {
+        if (!npcatOffsetsValid(base, h, stringColumns[c])) return "string offset outside the string pool";
+    }
+
+    const uint8_t *diet = base + h->sections[NPCAT_FOOD_DIET].offset;
+    const uint8_t *goals = base + h->sections[NPCAT_FOOD_GOALS].offset;
+    const uint8_t *mealTimes = base + h->sections[NPCAT_FOOD_MEAL_TIMES].offset;
+    const uint8_t *budgets = base + h->sections[NPCAT_FOOD_BUDGETS].offset;
+    const uint32_t *stepStart = (const uint32_t*)(base + h->sections[NPCAT_FOOD_STEP_START].offset);
+    if (stepStart[0] != 0 || stepStart[h->numFoods] != h->numSteps) return "step ranges do not cover the steps";
+    for (uint32_t row = 0; row < h->numFoods; row++) {
+        if (diet[row] >= h->numDietTypes) return "diet code out of range";
+        if ((goals[row] >> h->numGoals) != 0 || (mealTimes[row] >> h->numMealTimes) != 0 ||
+            (budgets[row] >> h->numBudgets) != 0) {
+            return "tag bit out of range";
+        }
+        if (stepStart[row] > stepStart[row + 1]) return "step ranges out of order";
+    }
+    return NULL;
+}
+
+// Map a catalogue file and validate it (see npcatValidate)
+// Returns 0 on success, -1 on error (message printed)
+// Time Complexity: O(foods + steps) - one pass over the index columns
+static inline int npcatOpen(const char *path, NpcatFile *cat) {
+    memset(cat, 0, sizeof(NpcatFile));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("❌ Cannot open catalogue %s\n", path);
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(NpcatHeader)) {
+        printf("❌ Catalogue %s is truncated\n", path);
+        close(fd);
+        return -1;
+    }
+    void *base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);  // the mapping keeps the file alive
+    if (base == MAP_FAILED) {
+        printf("❌ Cannot mmap catalogue %s\n", path);
+        return -1;
+    }
+
+    const NpcatHeader *header = (const NpcatHeader*)base;
+    if (memcmp(header->magic, NPCAT_MAGIC, 8) != 0 || header->version != NPCAT_VERSION ||
+        header->headerSize != sizeof(NpcatHeader) || header->fileSize != (uint64_t)st.st_size) {
+        printf("❌ %s is not a version %d catalogue\n", path, NPCAT_VERSION);
+        munmap(base, (size_t)st.st_size);
+        return -1;
+    }
+    const char *problem = npcatValidate((const uint8_t*)base, header);
+    if (problem != NULL) {
+        printf("❌ Catalogue %s is corrupt: %s\n", path, problem);
+        munmap(base, (size_t)st.st_size);
+        return -1;
+    }
+
+    cat->base = (const uint8_t*)base;
+    cat->size = (size_t)st.st_size;
+    cat->header = header;
+    return 0;
+}
+
+static inline void npcatClose(NpcatFile *cat) {
+    if (cat->base != NULL) munmap((void*)cat->base, cat->size);
+    memset(cat, 0, sizeof(NpcatFile));
+}
+
+// Pointer to the first element of a section
+static inline const void* npcatSection(const NpcatFile *cat, int section) {
+    return cat->base + cat->header->sections[section].offset;
+}
+
+// Resolve a string offset
+static inline const char* npcatString(const NpcatFile *cat, uint32_t offset) {
+    return (const char*)npcatSection(cat, NPCAT_STRINGS) + offset;
+}
+
+// Shorthand for a string column entry, e.g. npcatText(cat, NPCAT_FOOD_NAME, row)
+static inline const char* npcatText(const NpcatFile *cat, int section, uint32_t row) {
+    return npcatString(cat, ((const uint32_t*)npcatSection(cat, section))[row]);
+}
+
+// Bit (or diet code) assigned to a tag name in one of the *_NAMES sections,
+// -1 if the catalogue never uses that name
+static inline int npcatTagIndex(const NpcatFile *cat, int namesSection, const char *name) {
+    uint32_t count = (uint32_t)(cat->header->sections[namesSection].size / sizeof(uint32_t));
+    for (uint32_t i = 0; i < count; i++) {
+        if (strcmp(npcatText(cat, namesSection, i), name) == 0) return (int)i;
+    }
+    return -1;
+}
+
+#endif
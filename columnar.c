@@ -0,0 +1,572 @@
+// Columnar (Structure-of-Arrays) Food Catalogue with SIMD Filters
+// NutriPlan - Data Structures Project
+// Stores each nutrient in its own contiguous column so full-catalogue
+// filters (findByDietType, searchInRange) stream only the bytes they test
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <float.h>
+#include <time.h>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define HAVE_X86_SIMD 1
+#else
+#define HAVE_X86_SIMD 0
+#endif
+
+#define BLOCK_ROWS 64        // rows per bitmap word; columns are padded to this
+#define COLUMN_ALIGN 64      // cache-line aligned columns for aligned SIMD loads
+#define MAX_DIET_TYPES 255
+#define UNKNOWN_DIET 255
+
+// Kernel implementations, picked once at startup
+#define SIMD_SCALAR 0
+#define SIMD_SSE2   1
+#define SIMD_AVX2   2
+
+int simdLevel = SIMD_SCALAR;
+
+// Columnar catalogue: row id = index into every column
+typedef struct {
+    int32_t *calories;
+    float *protein;
+    float *carbs;
+    float *fats;
+    float *cost;
+    uint8_t *dietType;          // code into dietDict
+    uint32_t *nameOffset;       // start of each name in namePool
+    char *namePool;             // NUL-terminated names, back to back
+    size_t namePoolSize;
+    size_t namePoolCapacity;
+    char dietDict[MAX_DIET_TYPES][20];
+    int numDietTypes;
+    size_t count;
+    size_t capacity;            // always a multiple of BLOCK_ROWS
+} ColumnarCatalogue;
+
+// Number of 64-bit bitmap words covering the catalogue
+size_t bitmapWords(const ColumnarCatalogue *catalogue) {
+    return (catalogue->count + BLOCK_ROWS - 1) / BLOCK_ROWS;
+}
+
+// Pick the widest kernel set the CPU supports
+void detectSimd() {
+#if HAVE_X86_SIMD
+    __builtin_cpu_init();
+    simdLevel = __builtin_cpu_supports("avx2") ? SIMD_AVX2 : SIMD_SSE2;
+#else
+    simdLevel = SIMD_SCALAR;
+#endif
+}
+
+const char* simdName(int level) {
+    if (level == SIMD_AVX2) return "AVX2";
+    if (level == SIMD_SSE2) return "SSE2";
+    return "scalar";
+}
+
+// ================= CATALOGUE STORAGE =================
+
+void initCatalogue(ColumnarCatalogue *catalogue) {
+    memset(catalogue, 0, sizeof(ColumnarCatalogue));
+}
+
+// Copy of one column at newCapacity elements, keeping alignment; the old
+// column is left alone so a failed grow can be undone
+// Padding rows are zero-filled so kernels can always process whole blocks
+void* growColumn(const void *column, size_t elemSize, size_t oldCapacity, size_t newCapacity) {
+    size_t bytes = (newCapacity * elemSize + COLUMN_ALIGN - 1) / COLUMN_ALIGN * COLUMN_ALIGN;
+    void *grown = aligned_alloc(COLUMN_ALIGN, bytes);
+    if (grown == NULL) return NULL;
+    memset(grown, 0, bytes);
+    if (column != NULL) memcpy(grown, column, oldCapacity * elemSize);
+    return grown;
+}
+
+// Grow every column to hold rows; all or nothing, so on failure the
+// catalogue keeps its old columns and capacity
+// Returns 0 on success, -1 if out of memory
+int reserveRows(ColumnarCatalogue *catalogue, size_t rows) {
+    if (rows <= catalogue->capacity) return 0;
+    size_t newCapacity = catalogue->capacity == 0 ? 1024 : catalogue->capacity;
+    while (newCapacity < rows) newCapacity *= 2;
+    size_t old = catalogue->capacity;
+
+    int32_t *calories = (int32_t*)growColumn(catalogue->calories, sizeof(int32_t), old, newCapacity);
+    float *protein = (float*)growColumn(catalogue->protein, sizeof(float), old, newCapacity);
+    float *carbs = (float*)growColumn(catalogue->carbs, sizeof(float), old, newCapacity);
+    float *fats = (float*)growColumn(catalogue->fats, sizeof(float), old, newCapacity);
+    float *cost = (float*)growColumn(catalogue->cost, sizeof(float), old, newCapacity);
+    uint8_t *dietType = (uint8_t*)growColumn(catalogue->dietType, sizeof(uint8_t), old, newCapacity);
+    uint32_t *nameOffset = (uint32_t*)growColumn(catalogue->nameOffset, sizeof(uint32_t), old, newCapacity);
+    if (!calories || !protein || !carbs || !fats || !cost || !dietType || !nameOffset) {
+        free(calories);
+        free(protein);
+        free(carbs);
+        free(fats);
+        free(cost);
+        free(dietType);
+        free(nameOffset);
+        printf("❌ Out of memory growing catalogue\n");
+        return -1;
+    }
+
+    free(catalogue->calories);
+    free(catalogue->protein);
+    free(catalogue->carbs);
+    free(catalogue->fats);
+    free(catalogue->cost);
+    free(catalogue->dietType);
+    free(catalogue->nameOffset);
+    catalogue->calories = calories;
+    catalogue->protein = protein;
+    catalogue->carbs = carbs;
+    catalogue->fats = fats;
+    catalogue->cost = cost;
+    catalogue->dietType = dietType;
+    catalogue->nameOffset = nameOffset;
+    catalogue->capacity = newCapacity;
+    return 0;
+}
+
+// Dictionary-encode a diet type string (adds it if new)
+// Time Complexity: O(d) where d = distinct diet types
+uint8_t encodeDietType(ColumnarCatalogue *catalogue, const char *dietType) {
+    for (int i = 0; i < catalogue->numDietTypes; i++) {
+        if (strcmp(catalogue->dietDict[i], dietType) == 0) return (uint8_t)i;
+    }
+    if (catalogue->numDietTypes >= MAX_DIET_TYPES - 1) return UNKNOWN_DIET;
+    snprintf(catalogue->dietDict[catalogue->numDietTypes], 20, "%s", dietType);
+    return (uint8_t)catalogue->numDietTypes++;
+}
+
+// Look up a diet code without adding (UNKNOWN_DIET if absent)
+uint8_t findDietCode(const ColumnarCatalogue *catalogue, const char *dietType) {
+    for (int i = 0; i < catalogue->numDietTypes; i++) {
+        if (strcmp(catalogue->dietDict[i], dietType) == 0) return (uint8_t)i;
+    }
+    return UNKNOWN_DIET;
+}
+
+// Append a food, returns its row id
+// Time Complexity: O(1) amortized
+long addFood(ColumnarCatalogue *catalogue, const char *name, int calories, float protein,
+             float carbs, float fats, float cost, const char *dietType) {
+    if (reserveRows(catalogue, catalogue->count + 1) != 0) return -1;
+
+    size_t nameLen = strlen(name) + 1;
+    if (catalogue->namePoolSize + nameLen > catalogue->namePoolCapacity) {
+        size_t newCapacity = catalogue->namePoolCapacity == 0 ? 4096 : catalogue->namePoolCapacity * 2;
+        while (newCapacity < catalogue->namePoolSize + nameLen) newCapacity *= 2;
+        char *pool = (char*)realloc(catalogue->namePool, newCapacity);
+        if (pool == NULL) return -1;
+        catalogue->namePool = pool;
+        catalogue->namePoolCapacity = newCapacity;
+    }
+
+    size_t row = catalogue->count++;
+    memcpy(catalogue->namePool + catalogue->namePoolSize, name, nameLen);
+    catalogue->nameOffset[row] = (uint32_t)catalogue->namePoolSize;
+    catalogue->namePoolSize += nameLen;
+
+    catalogue->calories[row] = calories;
+    catalogue->protein[row] = protein;
+    catalogue->carbs[row] = carbs;
+    catalogue->fats[row] = fats;
+    catalogue->cost[row] = cost;
+    catalogue->dietType[row] = encodeDietType(catalogue, dietType);
+    return (long)row;
+}
+
+const char* foodName(const ColumnarCatalogue *catalogue, size_t row) {
+    return catalogue->namePool + catalogue->nameOffset[row];
+}
+
+void freeCatalogue(ColumnarCatalogue *catalogue) {
+    free(catalogue->calories);
+    free(catalogue->protein);
+    free(catalogue->carbs);
+    free(catalogue->fats);
+    free(catalogue->cost);
+    free(catalogue->dietType);
+    free(catalogue->nameOffset);
+    free(catalogue->namePool);
+    initCatalogue(catalogue);
+}
+
+// ================= SCALAR KERNELS =================
+// Each kernel writes one bit per row: bit (row % 64) of word (row / 64)
+
+void rangeInt32Scalar(const int32_t *column, size_t words, int32_t lo, int32_t hi, uint64_t *out) {
+    uint32_t span = (uint32_t)hi - (uint32_t)lo;
+    for (size_t w = 0; w < words; w++) {
+        const int32_t *v = column + w * BLOCK_ROWS;
+        uint64_t bits = 0;
+        for (int i = 0; i < BLOCK_ROWS; i++) {
+            bits |= (uint64_t)((uint32_t)v[i] - (uint32_t)lo <= span) << i;
+        }
+        out[w] = bits;
+    }
+}
+
+void rangeFloatScalar(const float *column, size_t words, float lo, float hi, uint64_t *out) {
+    for (size_t w = 0; w < words; w++) {
+        const float *v = column + w * BLOCK_ROWS;
+        uint64_t bits = 0;
+        for (int i = 0; i < BLOCK_ROWS; i++) {
+            bits |= (uint64_t)(v[i] >= lo && v[i] <= hi) << i;
+        }
+        out[w] = bits;
+    }
+}
+
+void equalByteScalar(const uint8_t *column, size_t words, uint8_t value, uint64_t *out) {
+    for (size_t w = 0; w < words; w++) {
+        const uint8_t *v = column + w * BLOCK_ROWS;
+        uint64_t bits = 0;
+        for (int i = 0; i < BLOCK_ROWS; i++) {
+            bits |= (uint64_t)(v[i] == value) << i;
+        }
+        out[w] = bits;
+    }
+}
+
+#if HAVE_X86_SIMD
+// ================= SSE2 KERNELS (x86-64 baseline) =================
+
+void rangeInt32Sse2(const int32_t *column, size_t words, int32_t lo, int32_t hi, uint64_t *out) {
+    __m128i vlo = _mm_set1_epi32(lo);
+    __m128i vhi = _mm_set1_epi32(hi);
+    for (size_t w = 0; w < words; w++) {
+        const int32_t *v = column + w * BLOCK_ROWS;
+        uint64_t bits = 0;
+        for (int i = 0; i < BLOCK_ROWS; i += 4) {
+            __m128i x = _mm_load_si128((const __m128i*)(v + i));
+            __m128i outside = _mm_or_si128(_mm_cmplt_epi32(x, vlo), _mm_cmpgt_epi32(x, vhi));
+            bits |= (uint64_t)(~_mm_movemask_ps(_mm_castsi128_ps(outside)) & 0xF) << i;
+        }
+        out[w] = bits;
+    }
+}
+
+void rangeFloatSse2(const float *column, size_t words, float lo, float hi, uint64_t *out) {
+    __m128 vlo = _mm_set1_ps(lo);
+    __m128 vhi = _mm_set1_ps(hi);
+    for (size_t w = 0; w < words; w++) {
+        const float *v = column + w * BLOCK_ROWS;
+        uint64_t bits = 0;
+        for (int i = 0; i < BLOCK_ROWS; i += 4) {
+            __m128 x = _mm_load_ps(v + i);
+            __m128 inside = _mm_and_ps(_mm_cmpge_ps(x, vlo), _mm_cmple_ps(x, vhi));
+            bits |= (uint64_t)_mm_movemask_ps(inside) << i;
+        }
+        out[w] = bits;
+    }
+}
+
+void equalByteSse2(const uint8_t *column, size_t words, uint8_t value, uint64_t *out) {
+    __m128i target = _mm_set1_epi8((char)value);
+    for (size_t w = 0; w < words; w++) {
+        const uint8_t *v = column + w * BLOCK_ROWS;
+        uint64_t bits = 0;
+        for (int i = 0; i < BLOCK_ROWS; i += 16) {
+            __m128i x = _mm_load_si128((const __m128i*)(v + i));
+            bits |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, target)) << i;
+        }
+        out[w] = bits;
+    }
+}
+
+// ================= AVX2 KERNELS =================
+
+__attribute__((target("avx2")))
+void rangeInt32Avx2(const int32_t *column, size_t words, int32_t lo, int32_t hi, uint64_t *out) {
+    __m256i vlo = _mm256_set1_epi32(lo);
+    __m256i vhi = _mm256_set1_epi32(hi);
+    for (size_t w = 0; w < words; w++) {
+        const int32_t *v = column + w * BLOCK_ROWS;
+        uint64_t bits = 0;
+        for (int i = 0; i < BLOCK_ROWS; i += 8) {
+            __m256i x = _mm256_load_si256((const __m256i*)(v + i));
+            __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi32(vlo, x), _mm256_cmpgt_epi32(x, vhi));
+            bits |= (uint64_t)(~_mm256_movemask_ps(_mm256_castsi256_ps(outside)) & 0xFF) << i;
+        }
+        out[w] = bits;
+    }
+}
+
+__attribute__((target("avx2")))
+void rangeFloatAvx2(const float *column, size_t words, float lo, float hi, uint64_t *out) {
+    __m256 vlo = _mm256_set1_ps(lo);
+    __m256 vhi = _mm256_set1_ps(hi);
+    for (size_t w = 0; w < words; w++) {
+        const float *v = column + w * BLOCK_ROWS;
+        uint64_t bits = 0;
+        for (int i = 0; i < BLOCK_ROWS; i += 8) {
+            __m256 x = _mm256_load_ps(v + i);
+            __m256 inside = _mm256_and_ps(_mm256_cmp_ps(x, vlo, _CMP_GE_OQ),
+                                          _mm256_cmp_ps(x, vhi, _CMP_LE_OQ));
+            bits |= (uint64_t)_mm256_movemask_ps(inside) << i;
+        }
+        out[w] = bits;
+    }
+}
+
+__attribute__((target("avx2")))
+void equalByteAvx2(const uint8_t *column, size_t words, uint8_t value, uint64_t *out) {
+    __m256i target = _mm256_set1_epi8((char)value);
+    for (size_t w = 0; w < words; w++) {
+        const uint8_t *v = column + w * BLOCK_ROWS;
+        __m256i a = _mm256_load_si256((const __m256i*)v);
+        __m256i b = _mm256_load_si256((const __m256i*)(v + 32));
+        uint32_t low = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, target));
+        uint32_t high = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(b, target));
+        out[w] = (uint64_t)low | ((uint64_t)high << 32);
+    }
+}
+#endif
+
+// ================= SELECTION API =================
+
+// Clear bits for padding rows past the end of the catalogue
+void maskTail(const ColumnarCatalogue *catalogue, uint64_t *bitmap) {
+    size_t words = bitmapWords(catalogue);
+    size_t tail = catalogue->count % BLOCK_ROWS;
+    if (words > 0 && tail != 0) bitmap[words - 1] &= (1ULL << tail) - 1;
+}
+
+// Bitmap of foods with minCal <= calories <= maxCal
+// Time Complexity: O(n / lanes)
+void selectCalorieRange(const ColumnarCatalogue *catalogue, int32_t minCal, int32_t maxCal,
+                        uint64_t *bitmap) {
+    size_t words = bitmapWords(catalogue);
+    if (minCal > maxCal) {
+        memset(bitmap, 0, words * sizeof(uint64_t));
+        return;
+    }
+#if HAVE_X86_SIMD
+    if (simdLevel == SIMD_AVX2) rangeInt32Avx2(catalogue->calories, words, minCal, maxCal, bitmap);
+    else if (simdLevel == SIMD_SSE2) rangeInt32Sse2(catalogue->calories, words, minCal, maxCal, bitmap);
+    else
+#endif
+    rangeInt32Scalar(catalogue->calories, words, minCal, maxCal, bitmap);
+    maskTail(catalogue, bitmap);
+}
+
+// Bitmap of foods with lo <= column[row] <= hi, for any float column
+// (use -FLT_MAX / FLT_MAX for one-sided filters like "protein >= 20")
+// Time Complexity: O(n / lanes)
+void selectFloatRange(const ColumnarCatalogue *catalogue, const float *column, float lo, float hi,
+                      uint64_t *bitmap) {
+    size_t words = bitmapWords(catalogue);
+#if HAVE_X86_SIMD
+    if (simdLevel == SIMD_AVX2) rangeFloatAvx2(column, words, lo, hi, bitmap);
+    else if (simdLevel == SIMD_SSE2) rangeFloatSse2(column, words, lo, hi, bitmap);
+    else
+#endif
+    rangeFloatScalar(column, words, lo, hi, bitmap);
+    maskTail(catalogue, bitmap);
+}
+
+// Bitmap of foods with the given diet type (one dictionary lookup, then bytes)
+// Time Complexity: O(d + n / lanes)
+void selectDietType(const ColumnarCatalogue *catalogue, const char *dietType, uint64_t *bitmap) {
+    size_t words = bitmapWords(catalogue);
+    uint8_t code = findDietCode(catalogue, dietType);
+    if (code == UNKNOWN_DIET) {
+        memset(bitmap, 0, words * sizeof(uint64_t));
+        return;
+    }
+#if HAVE_X86_SIMD
+    if (simdLevel == SIMD_AVX2) equalByteAvx2(catalogue->dietType, words, code, bitmap);
+    else if (simdLevel == SIMD_SSE2) equalByteSse2(catalogue->dietType, words, code, bitmap);
+    else
+#endif
+    equalByteScalar(catalogue->dietType, words, code, bitmap);
+    maskTail(catalogue, bitmap);
+}
+
+// dst &= src
+void bitmapAnd(uint64_t *dst, const uint64_t *src, size_t words) {
+    for (size_t w = 0; w < words; w++) dst[w] &= src[w];
+}
+
+// Number of selected rows
+size_t bitmapCount(const uint64_t *bitmap, size_t words) {
+    size_t count = 0;
+    for (size_t w = 0; w < words; w++) count += (size_t)__builtin_popcountll(bitmap[w]);
+    return count;
+}
+
+// Print the selected foods (visits set bits only)
+void printSelection(const ColumnarCatalogue *catalogue, const uint64_t *bitmap) {
+    size_t words = bitmapWords(catalogue);
+    int shown = 0;
+    for (size_t w = 0; w < words; w++) {
+        uint64_t bits = bitmap[w];
+        while (bits != 0) {
+            size_t row = w * BLOCK_ROWS + (size_t)__builtin_ctzll(bits);
+            bits &= bits - 1;
+            printf("%d. %-25s %4d kcal | P:%.1fg C:%.1fg F:%.1fg | Rs.%.0f | %s\n",
+                   ++shown, foodName(catalogue, row), catalogue->calories[row],
+                   catalogue->protein[row], catalogue->carbs[row], catalogue->fats[row],
+                   catalogue->cost[row], catalogue->dietDict[catalogue->dietType[row]]);
+        }
+    }
+    if (shown == 0) printf("  No foods found\n");
+}
+
+// ================= BENCHMARK: ARRAY-OF-STRUCTS vs COLUMNS =================
+
+// Row layout used by tree.c / graph.c today
+typedef struct {
+    char name[50];
+    char hindiName[50];
+    int calories;
+    float protein;
+    float carbs;
+    float fats;
+    int cost;
+    char dietType[20];
+} FoodRecord;
+
+double elapsedMs(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+// Filter "veg, 200-400 kcal, >= 15g protein" over the whole catalogue
+void benchmarkFilters(size_t n, int rounds) {
+    static const char *diets[] = { "veg", "non-veg", "egg" };
+    ColumnarCatalogue catalogue;
+    initCatalogue(&catalogue);
+    reserveRows(&catalogue, n);
+
+    FoodRecord *records = (FoodRecord*)malloc(n * sizeof(FoodRecord));
+    char name[50];
+    srand(3);
+    for (size_t i = 0; i < n; i++) {
+        int calories = 50 + rand() % 700;
+        float protein = (float)(rand() % 400) / 10.0f;
+        const char *diet = diets[rand() % 3];
+        sprintf(name, "Food %zu", i);
+        addFood(&catalogue, name, calories, protein, 20.0f, 8.0f, 40.0f, diet);
+
+        FoodRecord *r = &records[i];
+        memset(r, 0, sizeof(FoodRecord));
+        strcpy(r->name, name);
+        r->calories = calories;
+        r->protein = protein;
+        r->carbs = 20.0f;
+        r->fats = 8.0f;
+        r->cost = 40;
+        strcpy(r->dietType, diet);
+    }
+
+    size_t words = bitmapWords(&catalogue);
+    uint64_t *selected = (uint64_t*)malloc(words * sizeof(uint64_t));
+    uint64_t *scratch = (uint64_t*)malloc(words * sizeof(uint64_t));
+
+    printf("=== BENCHMARK: %zu foods, veg & 200-400 kcal & >=15g protein, %d rounds ===\n", n, rounds);
+
+    size_t aosMatches = 0;
+    clock_t start = clock();
+    for (int r = 0; r < rounds; r++) {
+        aosMatches = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (strcmp(records[i].dietType, "veg") == 0 &&
+                records[i].calories >= 200 && records[i].calories <= 400 &&
+                records[i].protein >= 15.0f) {
+                aosMatches++;
+            }
+        }
+    }
+    double aosMs = elapsedMs(start) / rounds;
+    printf("%-22s %7.2f ms/filter | %6.2f GB/s of records\n", "Array of structs:",
+           aosMs, (double)n * sizeof(FoodRecord) / (aosMs * 1e6));
+
+    int savedLevel = simdLevel;
+    for (int level = SIMD_SCALAR; level <= savedLevel; level++) {
+        simdLevel = level;
+        size_t matches = 0;
+        start = clock();
+        for (int r = 0; r < rounds; r++) {
+            selectDietType(&catalogue, "veg", selected);
+            selectCalorieRange(&catalogue, 200, 400, scratch);
+            bitmapAnd(selected, scratch, words);
+            selectFloatRange(&catalogue, catalogue.protein, 15.0f, FLT_MAX, scratch);
+            bitmapAnd(selected, scratch, words);
+            matches = bitmapCount(selected, words);
+        }
+        double ms = elapsedMs(start) / rounds;
+        double columnBytes = (double)n * (sizeof(uint8_t) + sizeof(int32_t) + sizeof(float));
+        printf("Columnar (%-6s):     %7.2f ms/filter | %6.2f GB/s of columns\n",
+               simdName(level), ms, columnBytes / (ms * 1e6));
+        if (matches != aosMatches) printf("❌ Mismatch: %zu vs %zu\n", matches, aosMatches);
+    }
+    simdLevel = savedLevel;
+    printf("Matches: %zu\n\n", aosMatches);
+
+    free(selected);
+    free(scratch);
+    free(records);
+    freeCatalogue(&catalogue);
+}
+
+// Main function demonstrating columnar filters
+int main() {
+    ColumnarCatalogue catalogue;
+    initCatalogue(&catalogue);
+    detectSimd();
+
+    printf("=== NutriPlan Columnar Food Catalogue (SIMD: %s) ===\n\n", simdName(simdLevel));
+
+    addFood(&catalogue, "Moong Dal Cheela", 180, 12.0, 25.0, 4.0, 20, "veg");
+    addFood(&catalogue, "Oats Upma", 210, 8.0, 32.0, 6.0, 25, "veg");
+    addFood(&catalogue, "Egg Bhurji", 220, 18.0, 8.0, 14.0, 30, "egg");
+    addFood(&catalogue, "Poha", 250, 6.0, 40.0, 7.0, 15, "veg");
+    addFood(&catalogue, "Paneer Bhurji", 265, 18.5, 8.0, 14.0, 65, "veg");
+    addFood(&catalogue, "Idli Sambar", 280, 10.0, 48.0, 6.0, 40, "veg");
+    addFood(&catalogue, "Dal Tadka", 320, 14.0, 48.0, 8.0, 30, "veg");
+    addFood(&catalogue, "Fish Curry", 320, 28.0, 22.0, 14.0, 90, "non-veg");
+    addFood(&catalogue, "Egg Curry", 350, 20.0, 48.0, 10.0, 45, "egg");
+    addFood(&catalogue, "Chicken Curry", 380, 32.0, 35.0, 12.0, 80, "non-veg");
+    addFood(&catalogue, "Rajma Chawal", 380, 16.0, 58.0, 9.0, 35, "veg");
+    addFood(&catalogue, "Chole", 420, 18.0, 65.0, 10.0, 45, "veg");
+
+    size_t words = bitmapWords(&catalogue);
+    uint64_t *selected = (uint64_t*)calloc(words, sizeof(uint64_t));
+    uint64_t *scratch = (uint64_t*)calloc(words, sizeof(uint64_t));
+
+    printf("Foods: %zu | Diet dictionary: %d entries\n\n", catalogue.count, catalogue.numDietTypes);
+
+    // findByDietType use case
+    printf("=== Foods with diet type 'non-veg' ===\n");
+    selectDietType(&catalogue, "non-veg", selected);
+    printSelection(&catalogue, selected);
+
+    // searchInRange use case
+    printf("\n=== WEIGHT LOSS Foods (150-300 kcal, Veg) ===\n");
+    selectCalorieRange(&catalogue, 150, 300, selected);
+    selectDietType(&catalogue, "veg", scratch);
+    bitmapAnd(selected, scratch, words);
+    printSelection(&catalogue, selected);
+
+    // Compound filter with a protein floor
+    printf("\n=== MUSCLE GAIN Foods (300-450 kcal, >= 18g protein) ===\n");
+    selectCalorieRange(&catalogue, 300, 450, selected);
+    selectFloatRange(&catalogue, catalogue.protein, 18.0f, FLT_MAX, scratch);
+    bitmapAnd(selected, scratch, words);
+    printSelection(&catalogue, selected);
+    printf("Matches: %zu\n\n", bitmapCount(selected, words));
+
+    free(selected);
+    free(scratch);
+    freeCatalogue(&catalogue);
+
+    benchmarkFilters(1000000, 20);
+
+    return 0;
+}
@@ -0,0 +1,1117 @@
+// Graph (Compressed Sparse Row) for Food Substitution Network
+// NutriPlan - Data Structures Project
+// Frozen version of graph.c's substitution network: built once from an
+// edge list, then every vertex's substitutes sit in one contiguous slice
+// of a neighbour array. No vertex cap, no per-edge malloc, BFS scans
+// memory linearly, degree is O(1) and adjacency is a binary search.
+// Edges carry nutritional-distance weights for ranked top-K swaps, and a
+// bit-parallel multi-source BFS precomputes the swap list of every food.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "string_pool.h"
+
+// Names of every food in this program, interned once
+StringPool foodNames;
+
+// Food vertex structure
+typedef struct Food {
+    StringId name;
+    StringId hindiName;
+    int calories;
+    float protein;
+    uint8_t dietType;  // DietType
+} Food;
+
+// Undirected substitution link
+typedef struct {
+    uint32_t from;
+    uint32_t to;
+} Edge;
+
+// Growable edge list (input to buildCsr)
+typedef struct {
+    Edge *edges;
+    size_t count;
+    size_t capacity;
+} EdgeList;
+
+// Frozen graph: neighbours of v are neighbours[offsets[v] .. offsets[v + 1]),
+// sorted ascending and without duplicates
+typedef struct {
+    uint32_t numVertices;
+    uint32_t *offsets;     // numVertices + 1 entries
+    uint32_t *neighbours;  // offsets[numVertices] entries (2 per undirected edge)
+    Food *foods;           // optional vertex data, may be NULL
+    float *weights;        // parallel to neighbours, set by attachFoods
+    uint8_t *diet;         // DIET_MASK_* bit per vertex, set by attachFoods
+} CsrGraph;
+
+// Query only: no diet constraint (DIET_MASK_* bits are in string_pool.h)
+#define DIET_MASK_ANY      0x00
+
+// Nutritional distance scales: 100 kcal counts as much as 5g protein
+#define CALORIE_SCALE 100.0f
+#define PROTEIN_SCALE 5.0f
+
+// One ranked swap: the food and its path cost from the original
+typedef struct {
+    uint32_t food;
+    float cost;
+} Substitute;
+
+// Constraints on returned swaps; dietMask DIET_MASK_ANY means any diet
+typedef struct {
+    uint8_t dietMask;
+    int minCalories;
+    int maxCalories;
+    int k;
+} SubstituteQuery;
+
+// Reusable Dijkstra state. dist/stamp are only valid where stamp equals
+// the current generation, so starting a search is O(1) instead of O(V).
+typedef struct {
+    float *dist;
+    uint32_t *stamp;
+    uint32_t generation;
+    uint32_t numVertices;
+    Substitute *heap;      // lazy-deletion min-heap of (vertex, tentative cost)
+    int heapSize;
+    int heapCapacity;
+} SearchContext;
+
+#define BFS_BATCH 64        // sources per bit-parallel BFS (one uint64 bit each)
+#define MAX_SWAPS 255       // per-food counts are one byte
+#define MAX_THREADS 64
+
+// Precomputed swaps for every food: food v's list is
+// swaps[v * maxSwaps .. + count[v]), ordered by hop distance (depth[])
+typedef struct {
+    uint32_t numFoods;
+    int maxSwaps;
+    int maxDepth;
+    uint32_t *swaps;
+    uint8_t *depth;
+    uint8_t *count;
+} SwapTable;
+
+// ================= EDGE LIST =================
+
+void initEdgeList(EdgeList *list) {
+    list->edges = NULL;
+    list->count = 0;
+    list->capacity = 0;
+}
+
+// Append one link
+// Time Complexity: O(1) amortized
+int addEdgeToList(EdgeList *list, uint32_t from, uint32_t to) {
+    if (list->count == list->capacity) {
+        size_t newCapacity = list->capacity == 0 ? 64 : list->capacity * 2;
+        Edge *grown = (Edge*)realloc(list->edges, newCapacity * sizeof(Edge));
+        if (grown == NULL) {
+            printf("❌ Memory allocation failed!\n");
+            return -1;
+        }
+        list->edges = grown;
+        list->capacity = newCapacity;
+    }
+    list->edges[list->count].from = from;
+    list->edges[list->count].to = to;
+    list->count++;
+    return 0;
+}
+
+void freeEdgeList(EdgeList *list) {
+    free(list->edges);
+    initEdgeList(list);
+}
+
+// ================= CSR BUILD =================
+
+int compareVertex(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+// Build the frozen graph from an undirected edge list
+// Counting pass for degrees, prefix sum for offsets, scatter pass for
+// neighbours; each row is then sorted and deduplicated in place.
+// Self loops and edges with an out-of-range endpoint are dropped.
+// Time Complexity: O(V + E log d) where d is the largest degree
+// Space Complexity: O(V + E)
+int buildCsr(CsrGraph *graph, uint32_t numVertices, const EdgeList *list) {
+    memset(graph, 0, sizeof(CsrGraph));
+    graph->numVertices = numVertices;
+    graph->offsets = (uint32_t*)calloc((size_t)numVertices + 1, sizeof(uint32_t));
+    if (graph->offsets == NULL) {
+        printf("❌ Memory allocation failed!\n");
+        return -1;
+    }
+
+    // Pass 1: degree of every vertex, stored one slot ahead
+    for (size_t i = 0; i < list->count; i++) {
+        Edge e = list->edges[i];
+        if (e.from == e.to || e.from >= numVertices || e.to >= numVertices) continue;
+        graph->offsets[e.from + 1]++;
+        graph->offsets[e.to + 1]++;
+    }
+    for (uint32_t v = 0; v < numVertices; v++) {
+        graph->offsets[v + 1] += graph->offsets[v];
+    }
+
+    uint32_t total = graph->offsets[numVertices];
+    graph->neighbours = (uint32_t*)malloc((total > 0 ? total : 1) * sizeof(uint32_t));
+    uint32_t *cursor = (uint32_t*)malloc(((size_t)numVertices + 1) * sizeof(uint32_t));
+    if (graph->neighbours == NULL || cursor == NULL) {
+        printf("❌ Memory allocation failed!\n");
+        free(cursor);
+        free(graph->offsets);
+        free(graph->neighbours);
+        memset(graph, 0, sizeof(CsrGraph));
+        return -1;
+    }
+    memcpy(cursor, graph->offsets, ((size_t)numVertices + 1) * sizeof(uint32_t));
+
+    // Pass 2: scatter both directions
+    for (size_t i = 0; i < list->count; i++) {
+        Edge e = list->edges[i];
+        if (e.from == e.to || e.from >= numVertices || e.to >= numVertices) continue;
+        graph->neighbours[cursor[e.from]++] = e.to;
+        graph->neighbours[cursor[e.to]++] = e.from;
+    }
+
+    // Pass 3: sort each row, drop duplicate links and compact
+    uint32_t write = 0;
+    for (uint32_t v = 0; v < numVertices; v++) {
+        uint32_t start = graph->offsets[v];
+        uint32_t end = graph->offsets[v + 1];
+        qsort(graph->neighbours + start, end - start, sizeof(uint32_t), compareVertex);
+        graph->offsets[v] = write;
+        for (uint32_t i = start; i < end; i++) {
+            if (i == start || graph->neighbours[i] != graph->neighbours[i - 1]) {
+                graph->neighbours[write++] = graph->neighbours[i];
+            }
+        }
+    }
+    graph->offsets[numVertices] = write;
+    free(cursor);
+    return 0;
+}
+
+void freeCsr(CsrGraph *graph) {
+    free(graph->offsets);
+    free(graph->neighbours);
+    free(graph->weights);
+    free(graph->diet);
+    memset(graph, 0, sizeof(CsrGraph));
+}
+
+// Fill one vertex, interning its names into pool
+// Returns 0 on success, -1 if the diet type is unknown
+int setFood(StringPool *pool, Food *food, const char *name, const char *hindiName, int calories,
+            float protein, const char *dietType) {
+    int diet = parseDietType(dietType);
+    if (diet == DIET_UNKNOWN || diet == DIET_ANY) {
+        printf("❌ Unknown diet type '%s'!\n", dietType);
+        return -1;
+    }
+    food->name = internString(pool, name);
+    food->hindiName = internString(pool, hindiName);
+    food->calories = calories;
+    food->protein = protein;
+    food->dietType = (uint8_t)diet;
+    return 0;
+}
+
+// Nutritional distance between two foods (edge weight)
+float nutrientDistance(const Food *a, const Food *b) {
+    float dc = (float)(a->calories - b->calories) / CALORIE_SCALE;
+    float dp = (a->protein - b->protein) / PROTEIN_SCALE;
+    return sqrtf(dc * dc + dp * dp);
+}
+
+// Attach vertex data and derive edge weights and diet bits from it
+// Time Complexity: O(V + E)
+// Space Complexity: O(V + E)
+int attachFoods(CsrGraph *graph, Food *foods) {
+    uint32_t total = graph->offsets[graph->numVertices];
+    graph->foods = foods;
+    graph->weights = (float*)malloc((total > 0 ? total : 1) * sizeof(float));
+    graph->diet = (uint8_t*)malloc(graph->numVertices > 0 ? graph->numVertices : 1);
+    if (graph->weights == NULL || graph->diet == NULL) {
+        printf("❌ Memory allocation failed!\n");
+        return -1;
+    }
+    for (uint32_t v = 0; v < graph->numVertices; v++) {
+        graph->diet[v] = (uint8_t)(1u << foods[v].dietType);
+        for (uint32_t i = graph->offsets[v]; i < graph->offsets[v + 1]; i++) {
+            graph->weights[i] = nutrientDistance(&foods[v], &foods[graph->neighbours[i]]);
+        }
+    }
+    return 0;
+}
+
+// ================= QUERIES =================
+
+// Number of substitutes
+// Time Complexity: O(1)
+uint32_t getDegree(const CsrGraph *graph, uint32_t v) {
+    return graph->offsets[v + 1] - graph->offsets[v];
+}
+
+// Check if two foods are directly linked
+// Time Complexity: O(log d)
+int areConnected(const CsrGraph *graph, uint32_t food1, uint32_t food2) {
+    const uint32_t *row = graph->neighbours + graph->offsets[food1];
+    uint32_t lo = 0, hi = getDegree(graph, food1);
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (row[mid] < food2) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo < getDegree(graph, food1) && row[lo] == food2;
+}
+
+// BFS from source; order[] receives vertices in visit order (source first),
+// visited[] must be zeroed by the caller. Returns number of vertices reached.
+// Time Complexity: O(V + E) over the reached component
+// Space Complexity: O(V) caller-provided
+uint32_t bfsCsr(const CsrGraph *graph, uint32_t source, uint8_t *visited, uint32_t *order) {
+    uint32_t front = 0, rear = 0;
+    order[rear++] = source;
+    visited[source] = 1;
+
+    while (front < rear) {
+        uint32_t current = order[front++];
+        const uint32_t *row = graph->neighbours + graph->offsets[current];
+        uint32_t degree = getDegree(graph, current);
+        for (uint32_t i = 0; i < degree; i++) {
+            uint32_t adjFood = row[i];
+            if (!visited[adjFood]) {
+                visited[adjFood] = 1;
+                order[rear++] = adjFood;
+            }
+        }
+    }
+    return rear;
+}
+
+// Find substitutes using BFS (same report as graph.c)
+// Time Complexity: O(V + E)
+// Space Complexity: O(V)
+void findSubstitutes(const CsrGraph *graph, uint32_t foodIndex) {
+    if (foodIndex >= graph->numVertices) {
+        printf("❌ Invalid food index\n");
+        return;
+    }
+
+    uint8_t *visited = (uint8_t*)calloc(graph->numVertices, 1);
+    uint32_t *order = (uint32_t*)malloc(graph->numVertices * sizeof(uint32_t));
+    if (visited == NULL || order == NULL) {
+        printf("❌ Memory allocation failed!\n");
+        free(visited);
+        free(order);
+        return;
+    }
+    uint32_t reached = bfsCsr(graph, foodIndex, visited, order);
+    const Food *foods = graph->foods;
+
+    printf("\n🔍 ========================================\n");
+    printf("   FINDING SUBSTITUTES FOR:\n");
+    printf("========================================\n");
+    printf("Original: %s (%s)\n", poolString(&foodNames, foods[foodIndex].name),
+           poolString(&foodNames, foods[foodIndex].hindiName));
+    printf("  • %d kcal | %.1fg protein | %s\n\n",
+           foods[foodIndex].calories, foods[foodIndex].protein, dietTypeName(foods[foodIndex].dietType));
+
+    printf("AVAILABLE SWAPS:\n");
+    printf("----------------------------------------\n");
+    for (uint32_t i = 1; i < reached; i++) {
+        const Food *f = &foods[order[i]];
+        printf("%u. %s (%s)\n", i, poolString(&foodNames, f->name), poolString(&foodNames, f->hindiName));
+        printf("   • %d kcal | %.1fg protein | %s\n\n", f->calories, f->protein, dietTypeName(f->dietType));
+    }
+
+    if (reached <= 1) {
+        printf("  ❌ No direct substitutes found\n");
+    } else {
+        printf("----------------------------------------\n");
+        printf("Total substitutes found: %u\n", reached - 1);
+    }
+    printf("========================================\n\n");
+
+    free(visited);
+    free(order);
+}
+
+// Display entire graph
+// Time Complexity: O(V + E)
+void displayGraph(const CsrGraph *graph) {
+    printf("\n🕸️  ========================================\n");
+    printf("   FOOD SUBSTITUTION NETWORK (CSR)\n");
+    printf("========================================\n\n");
+
+    for (uint32_t v = 0; v < graph->numVertices; v++) {
+        printf("%s → ", poolString(&foodNames, graph->foods[v].name));
+        if (getDegree(graph, v) == 0) printf("(no substitutes)");
+        for (uint32_t i = graph->offsets[v]; i < graph->offsets[v + 1]; i++) {
+            printf("%s%s", i > graph->offsets[v] ? ", " : "",
+                   poolString(&foodNames, graph->foods[graph->neighbours[i]].name));
+        }
+        printf("\n");
+    }
+    printf("\n========================================\n\n");
+}
+
+// ================= RANKED SUBSTITUTES (DIJKSTRA, EARLY STOP) =================
+
+int initSearchContext(SearchContext *ctx, uint32_t numVertices) {
+    ctx->dist = (float*)malloc((numVertices > 0 ? numVertices : 1) * sizeof(float));
+    ctx->stamp = (uint32_t*)calloc(numVertices > 0 ? numVertices : 1, sizeof(uint32_t));
+    ctx->generation = 0;
+    ctx->numVertices = numVertices;
+    ctx->heapCapacity = 64;
+    ctx->heapSize = 0;
+    ctx->heap = (Substitute*)malloc(ctx->heapCapacity * sizeof(Substitute));
+    if (ctx->dist == NULL || ctx->stamp == NULL || ctx->heap == NULL) {
+        printf("❌ Memory allocation failed!\n");
+        return -1;
+    }
+    return 0;
+}
+
+void freeSearchContext(SearchContext *ctx) {
+    free(ctx->dist);
+    free(ctx->stamp);
+    free(ctx->heap);
+    memset(ctx, 0, sizeof(SearchContext));
+}
+
+// Time Complexity: O(log h)
+int heapPush(SearchContext *ctx, uint32_t food, float cost) {
+    if (ctx->heapSize == ctx->heapCapacity) {
+        Substitute *grown = (Substitute*)realloc(ctx->heap, 2 * ctx->heapCapacity * sizeof(Substitute));
+        if (grown == NULL) return -1;
+        ctx->heap = grown;
+        ctx->heapCapacity *= 2;
+    }
+    int index = ctx->heapSize++;
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (ctx->heap[parent].cost <= cost) break;
+        ctx->heap[index] = ctx->heap[parent];
+        index = parent;
+    }
+    ctx->heap[index].food = food;
+    ctx->heap[index].cost = cost;
+    return 0;
+}
+
+// Time Complexity: O(log h)
+Substitute heapPop(SearchContext *ctx) {
+    Substitute top = ctx->heap[0];
+    Substitute last = ctx->heap[--ctx->heapSize];
+    int index = 0;
+    while (1) {
+        int child = 2 * index + 1;
+        if (child >= ctx->heapSize) break;
+        if (child + 1 < ctx->heapSize && ctx->heap[child + 1].cost < ctx->heap[child].cost) child++;
+        if (last.cost <= ctx->heap[child].cost) break;
+        ctx->heap[index] = ctx->heap[child];
+        index = child;
+    }
+    if (ctx->heapSize > 0) ctx->heap[index] = last;
+    return top;
+}
+
+int matchesQuery(const CsrGraph *graph, uint32_t v, const SubstituteQuery *q) {
+    return (q->dietMask == DIET_MASK_ANY || (graph->diet[v] & q->dietMask)) &&
+           graph->foods[v].calories >= q->minCalories &&
+           graph->foods[v].calories <= q->maxCalories;
+}
+
+// Closest swaps for foodIndex by total nutritional distance along
+// substitution links. Vertices are settled in cost order and the search
+// stops as soon as q->k of them satisfy the diet and calorie constraints;
+// non-matching foods may still be passed through. Results go to out[],
+// cheapest first; returns how many were found (< k if the component runs out).
+// Time Complexity: O(s d log(s d)) where s = vertices settled before the
+// k-th match and d = their degree, independent of component size
+// Space Complexity: O(V) in ctx, allocated once
+int rankedSubstitutes(const CsrGraph *graph, SearchContext *ctx, uint32_t foodIndex,
+                      const SubstituteQuery *q, Substitute *out) {
+    if (foodIndex >= graph->numVertices || q->k <= 0) return 0;
+
+    if (++ctx->generation == 0) {  // stamps wrapped: clear once every 2^32 searches
+        memset(ctx->stamp, 0, ctx->numVertices * sizeof(uint32_t));
+        ctx->generation = 1;
+    }
+    uint32_t gen = ctx->generation;
+    ctx->heapSize = 0;
+    ctx->dist[foodIndex] = 0.0f;
+    ctx->stamp[foodIndex] = gen;
+    heapPush(ctx, foodIndex, 0.0f);
+
+    int found = 0;
+    while (ctx->heapSize > 0 && found < q->k) {
+        Substitute top = heapPop(ctx);
+        uint32_t v = top.food;
+        if (top.cost > ctx->dist[v]) continue;  // stale entry
+        ctx->dist[v] = -1.0f;                   // settled
+
+        if (v != foodIndex && matchesQuery(graph, v, q)) out[found++] = top;
+
+        for (uint32_t i = graph->offsets[v]; i < graph->offsets[v + 1]; i++) {
+            uint32_t adjFood = graph->neighbours[i];
+            float cost = top.cost + graph->weights[i];
+            if (ctx->stamp[adjFood] != gen) {
+                ctx->stamp[adjFood] = gen;
+                ctx->dist[adjFood] = cost;
+                if (heapPush(ctx, adjFood, cost) != 0) return found;
+            } else if (cost < ctx->dist[adjFood]) {  // settled vertices hold -1
+                ctx->dist[adjFood] = cost;
+                if (heapPush(ctx, adjFood, cost) != 0) return found;
+            }
+        }
+    }
+    return found;
+}
+
+void printRankedSubstitutes(const CsrGraph *graph, SearchContext *ctx, uint32_t foodIndex,
+                            const SubstituteQuery *q) {
+    Substitute best[16];
+    SubstituteQuery capped = *q;
+    if (capped.k > 16) capped.k = 16;
+    int found = rankedSubstitutes(graph, ctx, foodIndex, &capped, best);
+
+    printf("\n🎯 Closest %d swaps for %s (%d-%d kcal%s):\n", capped.k,
+           poolString(&foodNames, graph->foods[foodIndex].name),
+           q->minCalories, q->maxCalories, q->dietMask == DIET_MASK_VEG ? ", veg only" : "");
+    for (int i = 0; i < found; i++) {
+        const Food *f = &graph->foods[best[i].food];
+        printf("  %d. %-16s distance %.2f | %d kcal | %.1fg protein | %s\n",
+               i + 1, poolString(&foodNames, f->name), best[i].cost, f->calories, f->protein,
+               dietTypeName(f->dietType));
+    }
+    if (found == 0) printf("  ❌ No substitutes match\n");
+}
+
+// ================= BULK SWAP TABLE (BIT-PARALLEL MULTI-SOURCE BFS) =================
+// Sources are processed 64 at a time: seen[v] / frontier[v] hold one bit per
+// source, so one scan of a shared neighbour row advances every source whose
+// search reached that vertex. Only vertices on the current frontier are
+// expanded, and a source's bit is dropped once its list is full.
+
+// Per-thread scratch; cleared through the touched list, never with O(V) memsets
+typedef struct {
+    uint64_t *seen;
+    uint64_t *frontier;
+    uint64_t *next;
+    uint32_t *current;    // vertices with frontier bits
+    uint32_t *upcoming;   // vertices with next bits
+    uint32_t *touched;    // every vertex seen in this batch
+} BfsScratch;
+
+typedef struct {
+    const CsrGraph *graph;
+    SwapTable *table;
+    uint32_t nextBatch;   // first unclaimed source, advanced atomically
+} SwapJob;
+
+// One thread's share: the job plus scratch allocated before it starts
+typedef struct {
+    SwapJob *job;
+    BfsScratch scratch;
+} SwapWorker;
+
+int initBfsScratch(BfsScratch *sc, uint32_t n) {
+    size_t words = n > 0 ? n : 1;
+    sc->seen = (uint64_t*)calloc(words, sizeof(uint64_t));
+    sc->frontier = (uint64_t*)calloc(words, sizeof(uint64_t));
+    sc->next = (uint64_t*)calloc(words, sizeof(uint64_t));
+    sc->current = (uint32_t*)malloc(words * sizeof(uint32_t));
+    sc->upcoming = (uint32_t*)malloc(words * sizeof(uint32_t));
+    sc->touched = (uint32_t*)malloc(words * sizeof(uint32_t));
+    return sc->seen && sc->frontier && sc->next && sc->current && sc->upcoming && sc->touched ? 0 : -1;
+}
+
+void freeBfsScratch(BfsScratch *sc) {
+    free(sc->seen);
+    free(sc->frontier);
+    free(sc->next);
+    free(sc->current);
+    free(sc->upcoming);
+    free(sc->touched);
+    memset(sc, 0, sizeof(BfsScratch));
+}
+
+// Fill the swap lists of sources [base, base + batch)
+// Time Complexity: O(sum of frontier degrees up to maxDepth), shared by the batch
+void swapBatch(const CsrGraph *graph, SwapTable *table, BfsScratch *sc, uint32_t base, int batch) {
+    int maxSwaps = table->maxSwaps;
+    uint64_t active = batch == 64 ? ~0ULL : (1ULL << batch) - 1;
+    uint32_t numCurrent = 0, numTouched = 0;
+    int count[BFS_BATCH] = {0};
+    uint32_t *swaps = table->swaps + (size_t)base * maxSwaps;
+    uint8_t *depth = table->depth + (size_t)base * maxSwaps;
+
+    for (int b = 0; b < batch; b++) {
+        uint32_t s = base + (uint32_t)b;
+        sc->seen[s] = sc->frontier[s] = 1ULL << b;
+        sc->current[numCurrent++] = s;
+        sc->touched[numTouched++] = s;
+    }
+
+    for (int d = 1; d <= table->maxDepth && active != 0 && numCurrent > 0; d++) {
+        // Push frontier bits of still-active sources to neighbours not yet
+        // reached by them, recording each discovery as it happens so a
+        // source stops spreading the moment its list is full
+        uint32_t numUpcoming = 0;
+        for (uint32_t i = 0; i < numCurrent && active != 0; i++) {
+            uint32_t u = sc->current[i];
+            uint64_t bits = sc->frontier[u] & active;
+            sc->frontier[u] = 0;
+            for (uint32_t e = graph->offsets[u]; e < graph->offsets[u + 1] && bits != 0; e++) {
+                uint32_t w = graph->neighbours[e];
+                uint64_t fresh = bits & ~(sc->seen[w] | sc->next[w]);
+                if (fresh == 0) continue;
+                if (sc->next[w] == 0) sc->upcoming[numUpcoming++] = w;
+                sc->next[w] |= fresh;
+                while (fresh != 0) {
+                    int b = __builtin_ctzll(fresh);
+                    fresh &= fresh - 1;
+                    size_t slot = (size_t)b * maxSwaps + count[b];
+                    swaps[slot] = w;
+                    depth[slot] = (uint8_t)d;
+                    if (++count[b] == maxSwaps) active &= ~(1ULL << b);
+                }
+                bits &= active;
+            }
+        }
+        for (uint32_t i = 0; i < numCurrent; i++) sc->frontier[sc->current[i]] = 0;
+
+        // Newly reached vertices become the next frontier
+        for (uint32_t i = 0; i < numUpcoming; i++) {
+            uint32_t w = sc->upcoming[i];
+            if (sc->seen[w] == 0) sc->touched[numTouched++] = w;
+            sc->seen[w] |= sc->next[w];
+            sc->frontier[w] = sc->next[w];
+            sc->next[w] = 0;
+        }
+
+        uint32_t *swap = sc->current;
+        sc->current = sc->upcoming;
+        sc->upcoming = swap;
+        numCurrent = numUpcoming;
+    }
+
+    for (uint32_t i = 0; i < numCurrent; i++) sc->frontier[sc->current[i]] = 0;
+    for (uint32_t i = 0; i < numTouched; i++) sc->seen[sc->touched[i]] = 0;
+    for (int b = 0; b < batch; b++) table->count[base + b] = (uint8_t)count[b];
+}
+
+void* swapWorker(void *arg) {
+    SwapWorker *worker = (SwapWorker*)arg;
+    SwapJob *job = worker->job;
+    uint32_t n = job->graph->numVertices;
+    while (1) {
+        uint32_t base = __atomic_fetch_add(&job->nextBatch, BFS_BATCH, __ATOMIC_RELAXED);
+        if (base >= n) break;
+        int batch = n - base < BFS_BATCH ? (int)(n - base) : BFS_BATCH;
+        swapBatch(job->graph, job->table, &worker->scratch, base, batch);
+    }
+    return NULL;
+}
+
+void freeSwapTable(SwapTable *table) {
+    free(table->swaps);
+    free(table->depth);
+    free(table->count);
+    memset(table, 0, sizeof(SwapTable));
+}
+
+// Precompute up to maxSwaps substitutes within maxDepth hops for every food
+// Time Complexity: O(V/64 * explored edges per batch), split across threads
+// Space Complexity: O(V * maxSwaps) table + O(V) scratch per thread
+// Returns 0 on success, -1 on error (table left empty)
+int buildSwapTable(const CsrGraph *graph, int maxDepth, int maxSwaps, int numThreads, SwapTable *table) {
+    uint32_t n = graph->numVertices;
+    if (maxSwaps < 1 || maxSwaps > MAX_SWAPS || maxDepth < 1 || maxDepth > 255) {
+        printf("❌ maxSwaps must be 1-%d and maxDepth 1-255\n", MAX_SWAPS);
+        return -1;
+    }
+    if (numThreads < 1) numThreads = 1;
+    if (numThreads > MAX_THREADS) numThreads = MAX_THREADS;
+
+    SwapJob job = { graph, table, 0 };
+    SwapWorker *workers = NULL;
+    size_t slots = (size_t)n * maxSwaps;
+    table->numFoods = n;
+    table->maxSwaps = maxSwaps;
+    table->maxDepth = maxDepth;
+    table->swaps = (uint32_t*)malloc((slots > 0 ? slots : 1) * sizeof(uint32_t));
+    table->depth = (uint8_t*)malloc(slots > 0 ? slots : 1);
+    table->count = (uint8_t*)calloc(n > 0 ? n : 1, 1);
+    if (table->swaps == NULL || table->depth == NULL || table->count == NULL) goto fail;
+
+    // All scratch is allocated up front, so a thread never starts without it
+    workers = (SwapWorker*)calloc(numThreads, sizeof(SwapWorker));
+    if (workers == NULL) goto fail;
+    for (int t = 0; t < numThreads; t++) {
+        workers[t].job = &job;
+        if (initBfsScratch(&workers[t].scratch, n) != 0) goto fail;
+    }
+
+    pthread_t threads[MAX_THREADS];
+    int started = 0;
+    for (int t = 1; t < numThreads; t++) {
+        if (pthread_create(&threads[started], NULL, swapWorker, &workers[t]) == 0) started++;
+    }
+    swapWorker(&workers[0]);  // calling thread works too
+    for (int t = 0; t < started; t++) pthread_join(threads[t], NULL);
+    for (int t = 0; t < numThreads; t++) freeBfsScratch(&workers[t].scratch);
+    free(workers);
+    return 0;
+
+fail:
+    printf("❌ Memory allocation failed!\n");
+    if (workers != NULL) {
+        for (int t = 0; t < numThreads; t++) freeBfsScratch(&workers[t].scratch);  // zeroed if never set up
+    }
+    free(workers);
+    freeSwapTable(table);
+    return -1;
+}
+
+int defaultThreads(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus < 1 ? 1 : cpus > MAX_THREADS ? MAX_THREADS : (int)cpus;
+}
+
+// ================= BENCHMARK: CSR vs LINKED ADJACENCY LIST =================
+
+// Baseline: graph.c's layout (one malloc'd node per direction, prepended)
+typedef struct AdjNode {
+    int foodIndex;
+    struct AdjNode *next;
+} AdjNode;
+
+uint32_t bfsLinked(AdjNode **adjList, uint32_t source, uint8_t *visited, uint32_t *queue) {
+    uint32_t front = 0, rear = 0;
+    queue[rear++] = source;
+    visited[source] = 1;
+
+    while (front < rear) {
+        uint32_t current = queue[front++];
+        for (AdjNode *temp = adjList[current]; temp != NULL; temp = temp->next) {
+            if (!visited[temp->foodIndex]) {
+                visited[temp->foodIndex] = 1;
+                queue[rear++] = (uint32_t)temp->foodIndex;
+            }
+        }
+    }
+    return rear;
+}
+
+double elapsedMs(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+void benchmarkBfs(uint32_t numVertices, size_t numEdges, int sources) {
+    EdgeList list;
+    initEdgeList(&list);
+    srand(11);
+    while (list.count < numEdges) {
+        uint32_t a = (uint32_t)(((unsigned)rand() << 16 ^ (unsigned)rand()) % numVertices);
+        uint32_t b = (uint32_t)(((unsigned)rand() << 16 ^ (unsigned)rand()) % numVertices);
+        if (a != b && addEdgeToList(&list, a, b) != 0) break;
+    }
+
+    // Linked list inserted in edge order, like repeated addEdge calls
+    clock_t start = clock();
+    AdjNode **adjList = (AdjNode**)calloc(numVertices, sizeof(AdjNode*));
+    for (size_t i = 0; i < list.count; i++) {
+        Edge e = list.edges[i];
+        AdjNode *n1 = (AdjNode*)malloc(sizeof(AdjNode));
+        n1->foodIndex = (int)e.to;
+        n1->next = adjList[e.from];
+        adjList[e.from] = n1;
+        AdjNode *n2 = (AdjNode*)malloc(sizeof(AdjNode));
+        n2->foodIndex = (int)e.from;
+        n2->next = adjList[e.to];
+        adjList[e.to] = n2;
+    }
+    double linkedBuildMs = elapsedMs(start);
+
+    start = clock();
+    CsrGraph csr;
+    buildCsr(&csr, numVertices, &list);
+    double csrBuildMs = elapsedMs(start);
+
+    uint8_t *visited = (uint8_t*)malloc(numVertices);
+    uint32_t *queue = (uint32_t*)malloc(numVertices * sizeof(uint32_t));
+    uint64_t linkedReached = 0, csrReached = 0;
+
+    start = clock();
+    for (int s = 0; s < sources; s++) {
+        memset(visited, 0, numVertices);
+        linkedReached += bfsLinked(adjList, (uint32_t)s * 7919 % numVertices, visited, queue);
+    }
+    double linkedMs = elapsedMs(start);
+
+    start = clock();
+    for (int s = 0; s < sources; s++) {
+        memset(visited, 0, numVertices);
+        csrReached += bfsCsr(&csr, (uint32_t)s * 7919 % numVertices, visited, queue);
+    }
+    double csrMs = elapsedMs(start);
+
+    start = clock();
+    uint64_t linkedDegrees = 0, csrDegrees = 0;
+    for (uint32_t v = 0; v < numVertices; v++) {
+        for (AdjNode *temp = adjList[v]; temp != NULL; temp = temp->next) linkedDegrees++;
+    }
+    double linkedDegreeMs = elapsedMs(start);
+    start = clock();
+    for (uint32_t v = 0; v < numVertices; v++) csrDegrees += getDegree(&csr, v);
+    double csrDegreeMs = elapsedMs(start);
+
+    printf("\n=== BENCHMARK: %u vertices, %zu edges, BFS from %d sources ===\n",
+           numVertices, list.count, sources);
+    printf("%-16s %12s %12s %14s\n", "", "build (ms)", "BFS (ms)", "all degrees");
+    printf("%-16s %12.1f %12.1f %11.1f ms\n", "Linked list", linkedBuildMs, linkedMs, linkedDegreeMs);
+    printf("%-16s %12.1f %12.1f %11.1f ms\n", "CSR", csrBuildMs, csrMs, csrDegreeMs);
+    printf("Vertices reached: %llu vs %llu (%s)\n", (unsigned long long)linkedReached,
+           (unsigned long long)csrReached, linkedReached == csrReached ? "match" : "MISMATCH");
+    printf("Adjacency entries: %llu linked, %llu CSR (duplicate links merged)\n",
+           (unsigned long long)linkedDegrees, (unsigned long long)csrDegrees);
+
+    for (uint32_t v = 0; v < numVertices; v++) {
+        AdjNode *temp = adjList[v];
+        while (temp != NULL) {
+            AdjNode *next = temp->next;
+            free(temp);
+            temp = next;
+        }
+    }
+    free(adjList);
+    free(visited);
+    free(queue);
+    freeCsr(&csr);
+    freeEdgeList(&list);
+}
+
+// Per-query latency of full-component BFS vs ranked top-K search as the
+// graph grows (average degree 10)
+void benchmarkRankedSearch(int k, int queries, int bfsQueries) {
+    const char *diets[] = { "veg", "veg", "egg", "non-veg" };
+    printf("\n=== BENCHMARK: top-%d ranked search (%d queries) vs full BFS (%d queries) ===\n",
+           k, queries, bfsQueries);
+    printf("%10s %18s %18s\n", "vertices", "BFS (us/query)", "top-K (us/query)");
+
+    for (uint32_t n = 10000; n <= 1000000; n *= 10) {
+        StringPool names;  // synthetic names stay out of the demo's foodNames
+        Food *foods = (Food*)malloc(n * sizeof(Food));
+        if (initStringPool(&names) != 0 || foods == NULL) {
+            freeStringPool(&names);
+            free(foods);
+            return;
+        }
+        EdgeList list;
+        initEdgeList(&list);
+        srand(13);
+        char name[32];
+        for (uint32_t v = 0; v < n; v++) {
+            snprintf(name, sizeof(name), "Food %u", v);
+            int calories = 100 + rand() % 500;
+            float protein = (float)(rand() % 400) / 10.0f;
+            setFood(&names, &foods[v], name, "", calories, protein, diets[rand() % 4]);
+        }
+        for (size_t e = 0; e < (size_t)n * 5; e++) {
+            uint32_t a = (uint32_t)(((unsigned)rand() << 16 ^ (unsigned)rand()) % n);
+            uint32_t b = (uint32_t)(((unsigned)rand() << 16 ^ (unsigned)rand()) % n);
+            addEdgeToList(&list, a, b);
+        }
+        CsrGraph graph;
+        buildCsr(&graph, n, &list);
+        attachFoods(&graph, foods);
+        freeEdgeList(&list);
+
+        uint8_t *visited = (uint8_t*)malloc(n);
+        uint32_t *order = (uint32_t*)malloc(n * sizeof(uint32_t));
+        uint64_t reached = 0;
+        clock_t start = clock();
+        for (int q = 0; q < bfsQueries; q++) {
+            memset(visited, 0, n);  // findSubstitutes clears its visited array per call
+            reached += bfsCsr(&graph, (uint32_t)q * 7919 % n, visited, order);
+        }
+        double bfsUs = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / bfsQueries;
+
+        SearchContext ctx;
+        initSearchContext(&ctx, n);
+        Substitute *best = (Substitute*)malloc(k * sizeof(Substitute));
+        SubstituteQuery query = { DIET_MASK_VEG, 150, 450, k };
+        uint64_t found = 0;
+        start = clock();
+        for (int q = 0; q < queries; q++) {
+            found += rankedSubstitutes(&graph, &ctx, (uint32_t)q * 7919 % n, &query, best);
+        }
+        double rankedUs = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / queries;
+
+        printf("%10u %18.1f %18.1f   (BFS reached %llu, top-K returned %llu)\n", n, bfsUs, rankedUs,
+               (unsigned long long)reached, (unsigned long long)found);
+
+        free(best);
+        freeSearchContext(&ctx);
+        free(visited);
+        free(order);
+        freeCsr(&graph);
+        free(foods);
+        freeStringPool(&names);
+    }
+}
+
+// Baseline: one bounded BFS per food (generation-stamped, early stop)
+int boundedBfs(const CsrGraph *graph, uint32_t source, int maxDepth, int maxSwaps,
+               uint32_t *stamp, uint32_t gen, uint32_t *queue, uint8_t *level,
+               uint32_t *outSwaps, uint8_t *outDepth) {
+    uint32_t front = 0, rear = 0;
+    int found = 0;
+    queue[rear] = source;
+    level[rear++] = 0;
+    stamp[source] = gen;
+    while (front < rear && found < maxSwaps) {
+        uint32_t u = queue[front];
+        int d = level[front++];
+        if (d == maxDepth) break;
+        for (uint32_t e = graph->offsets[u]; e < graph->offsets[u + 1] && found < maxSwaps; e++) {
+            uint32_t w = graph->neighbours[e];
+            if (stamp[w] == gen) continue;
+            stamp[w] = gen;
+            outSwaps[found] = w;
+            outDepth[found++] = (uint8_t)(d + 1);
+            queue[rear] = w;
+            level[rear++] = (uint8_t)(d + 1);
+        }
+    }
+    return found;
+}
+
+// Bulk swap precomputation: per-food BFS vs 64-source bit-parallel BFS.
+// The graph is shaped like similarity_graph.c's output with k = nearby:
+// each food links to nearby foods with close ids (as if sorted by
+// nutrients) plus one random link. Sharing only pays when batch
+// neighbourhoods overlap; on sparse graphs with short lists both methods
+// cost about the same per recorded swap.
+void benchmarkSwapTable(uint32_t n, int nearby, int maxDepth, int maxSwaps, int samples) {
+    EdgeList list;
+    initEdgeList(&list);
+    srand(14);
+    for (uint32_t v = 0; v < n; v++) {
+        for (int j = 0; j <= nearby; j++) {
+            uint32_t w = j == 0 ? (uint32_t)(((unsigned)rand() << 16 ^ (unsigned)rand()) % n)
+                                : (v + 1 + (uint32_t)(rand() % 64)) % n;
+            addEdgeToList(&list, v, w);
+        }
+    }
+    CsrGraph graph;
+    int built = buildCsr(&graph, n, &list);
+    freeEdgeList(&list);
+    if (built != 0) return;
+
+    uint32_t *stamp = (uint32_t*)calloc(n, sizeof(uint32_t));
+    uint32_t *queue = (uint32_t*)malloc(n * sizeof(uint32_t));
+    uint8_t *level = (uint8_t*)malloc(n);
+    uint32_t *hops = (uint32_t*)malloc(n * sizeof(uint32_t));
+    SwapTable perFood;  // same layout as buildSwapTable's output
+    perFood.swaps = (uint32_t*)malloc((size_t)n * maxSwaps * sizeof(uint32_t));
+    perFood.depth = (uint8_t*)malloc((size_t)n * maxSwaps);
+    perFood.count = (uint8_t*)malloc(n);
+    SwapTable table;
+    memset(&table, 0, sizeof(SwapTable));
+    if (stamp == NULL || queue == NULL || level == NULL || hops == NULL ||
+        perFood.swaps == NULL || perFood.depth == NULL || perFood.count == NULL) {
+        printf("❌ Memory allocation failed!\n");
+        goto cleanup;
+    }
+    uint64_t perFoodTotal = 0;
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (uint32_t v = 0; v < n; v++) {
+        size_t row = (size_t)v * maxSwaps;
+        perFood.count[v] = (uint8_t)boundedBfs(&graph, v, maxDepth, maxSwaps, stamp, v + 1, queue, level,
+                                               perFood.swaps + row, perFood.depth + row);
+        perFoodTotal += perFood.count[v];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double perFoodMs = (t1.tv_sec - t0.tv_sec) * 1000.0 + (t1.tv_nsec - t0.tv_nsec) / 1e6;
+
+    int threads = defaultThreads();
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (buildSwapTable(&graph, maxDepth, maxSwaps, threads, &table) != 0) goto cleanup;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double tableMs = (t1.tv_sec - t0.tv_sec) * 1000.0 + (t1.tv_nsec - t0.tv_nsec) / 1e6;
+
+    // Check sampled lists: same size as a plain BFS finds, every entry at its true hop distance
+    uint64_t tableTotal = 0;
+    uint32_t full = 0;
+    for (uint32_t v = 0; v < n; v++) {
+        tableTotal += table.count[v];
+        full += table.count[v] == maxSwaps;
+    }
+    int bad = 0;
+    for (int sIdx = 0; sIdx < samples; sIdx++) {
+        uint32_t v = (uint32_t)((uint64_t)sIdx * n / samples);
+        for (uint32_t i = 0; i < n; i++) hops[i] = UINT32_MAX;
+        memset(stamp, 0, n * sizeof(uint32_t));
+        uint8_t *visited = (uint8_t*)level;
+        memset(visited, 0, n);
+        uint32_t reached = bfsCsr(&graph, v, visited, queue);
+        hops[v] = 0;
+        for (uint32_t i = 0; i < reached; i++) {
+            uint32_t u = queue[i];
+            for (uint32_t e = graph.offsets[u]; e < graph.offsets[u + 1]; e++) {
+                if (hops[graph.neighbours[e]] == UINT32_MAX) hops[graph.neighbours[e]] = hops[u] + 1;
+            }
+        }
+        int expected = 0;
+        for (uint32_t i = 0; i < n; i++) expected += i != v && hops[i] <= (uint32_t)maxDepth;
+        if (expected > maxSwaps) expected = maxSwaps;
+        if (table.count[v] != expected) bad++;
+        for (int j = 0; j < table.count[v]; j++) {
+            size_t slot = (size_t)v * maxSwaps + j;
+            if (hops[table.swaps[slot]] != table.depth[slot]) {
+                bad++;
+                break;
+            }
+        }
+    }
+
+    printf("\n=== BENCHMARK: swap table for %u foods, k = %d (%u links, <= %d swaps within %d hops) ===\n",
+           n, nearby, graph.offsets[n] / 2, maxSwaps, maxDepth);
+    printf("BFS per food                 : %9.1f ms (%llu swaps)\n", perFoodMs, (unsigned long long)perFoodTotal);
+    printf("Bit-parallel x64, %d thread(s): %9.1f ms (%llu swaps)\n", threads, tableMs,
+           (unsigned long long)tableTotal);
+    printf("Lists cut off at %d swaps: %u of %u\n", maxSwaps, full, n);
+    printf("Sampled %d lists: %s\n", samples, bad == 0 ? "correct hop distances and sizes" : "MISMATCH");
+    printf("Table size: %.1f MB\n", (double)n * maxSwaps * (sizeof(uint32_t) + 1) / (1024.0 * 1024.0));
+
+cleanup:
+    free(hops);
+    free(stamp);
+    free(queue);
+    free(level);
+    freeSwapTable(&perFood);
+    freeSwapTable(&table);
+    freeCsr(&graph);
+}
+
+// Build: gcc -O2 -pthread csr_graph.c -lm
+// Usage: ./a.out [swap table foods], e.g. 200000 for the full-size
+// swap-table benchmark (about 243 MB per table); the default is a quick check
+// Main function demonstrating the frozen graph
+int main(int argc, char **argv) {
+    uint32_t swapFoods = argc > 1 ? (uint32_t)atol(argv[1]) : 20000;
+    printf("\n=== NutriPlan Food Substitution Network (CSR Graph) ===\n\n");
+
+    if (initStringPool(&foodNames) != 0) return 1;
+
+    // Same foods and links as graph.c
+    enum { PANEER, TOFU, CHICKEN, FISH, EGG, DAL, CHOLE, MUSHROOM, SOYA, RAJMA, NUM_DEMO_FOODS };
+    Food foods[NUM_DEMO_FOODS];
+    setFood(&foodNames, &foods[PANEER], "Paneer Bhurji", "पनीर भुर्जी", 265, 18.5, "veg");
+    setFood(&foodNames, &foods[TOFU], "Tofu Scramble", "टोफू", 180, 15.0, "veg");
+    setFood(&foodNames, &foods[CHICKEN], "Chicken Curry", "चिकन करी", 380, 32.0, "non-veg");
+    setFood(&foodNames, &foods[FISH], "Fish Curry", "मछली करी", 320, 28.0, "non-veg");
+    setFood(&foodNames, &foods[EGG], "Egg Curry", "अंडा करी", 350, 20.0, "egg");
+    setFood(&foodNames, &foods[DAL], "Dal Tadka", "दाल तड़का", 180, 12.0, "veg");
+    setFood(&foodNames, &foods[CHOLE], "Chole", "छोले", 420, 16.0, "veg");
+    setFood(&foodNames, &foods[MUSHROOM], "Mushroom Curry", "मशरूम करी", 150, 8.0, "veg");
+    setFood(&foodNames, &foods[SOYA], "Soya Chunks", "सोया", 200, 20.0, "veg");
+    setFood(&foodNames, &foods[RAJMA], "Rajma", "राजमा", 380, 16.0, "veg");
+    Food rejected;
+    printf("%s Unknown diet rejected\n", setFood(&foodNames, &rejected, "Tofu Tikka", "", 260, 20.0, "vegan") != 0 ? "✅" : "❌");
+
+    EdgeList list;
+    initEdgeList(&list);
+    addEdgeToList(&list, PANEER, TOFU);
+    addEdgeToList(&list, PANEER, MUSHROOM);
+    addEdgeToList(&list, PANEER, SOYA);
+    addEdgeToList(&list, CHICKEN, FISH);
+    addEdgeToList(&list, CHICKEN, EGG);
+    addEdgeToList(&list, DAL, CHOLE);
+    addEdgeToList(&list, DAL, RAJMA);
+    addEdgeToList(&list, DAL, TOFU);
+    addEdgeToList(&list, TOFU, SOYA);
+    addEdgeToList(&list, EGG, PANEER);
+    addEdgeToList(&list, CHOLE, RAJMA);
+    addEdgeToList(&list, RAJMA, CHOLE);  // duplicate link, merged by buildCsr
+
+    CsrGraph graph;
+    if (buildCsr(&graph, NUM_DEMO_FOODS, &list) != 0) return 1;
+    if (attachFoods(&graph, foods) != 0) return 1;
+    printf("✅ Built CSR graph: %u foods, %u adjacency entries from %zu links\n",
+           graph.numVertices, graph.offsets[graph.numVertices], list.count);
+    freeEdgeList(&list);
+
+    displayGraph(&graph);
+
+    findSubstitutes(&graph, PANEER);
+    findSubstitutes(&graph, CHICKEN);
+
+    printf("--- CHECKING SUBSTITUTION COMPATIBILITY (binary search) ---\n");
+    printf("Can Paneer substitute Tofu? %s\n", areConnected(&graph, PANEER, TOFU) ? "✅ Yes" : "❌ No");
+    printf("Can Chicken substitute Dal? %s\n", areConnected(&graph, CHICKEN, DAL) ? "✅ Yes" : "❌ No");
+    printf("Can Egg substitute Paneer? %s\n\n", areConnected(&graph, EGG, PANEER) ? "✅ Yes" : "❌ No");
+
+    printf("--- FINDING MOST VERSATILE FOODS (O(1) degree) ---\n");
+    for (uint32_t v = 0; v < graph.numVertices; v++) {
+        if (getDegree(&graph, v) >= 3) {
+            printf("🌟 %s: %u substitutes\n", poolString(&foodNames, foods[v].name), getDegree(&graph, v));
+        }
+    }
+
+    printf("\n--- RANKED SUBSTITUTES (nutritional distance, stops after K) ---\n");
+    SearchContext ctx;
+    if (initSearchContext(&ctx, graph.numVertices) == 0) {
+        SubstituteQuery anyDiet = { DIET_MASK_ANY, 0, 1000, 3 };
+        SubstituteQuery vegLight = { DIET_MASK_VEG, 0, 300, 3 };
+        printRankedSubstitutes(&graph, &ctx, PANEER, &anyDiet);
+        printRankedSubstitutes(&graph, &ctx, PANEER, &vegLight);
+        printRankedSubstitutes(&graph, &ctx, CHICKEN, &anyDiet);
+        freeSearchContext(&ctx);
+    }
+
+    printf("\n--- PRECOMPUTED SWAP TABLE (2 hops, up to 4 swaps per food) ---\n");
+    SwapTable swaps;
+    if (buildSwapTable(&graph, 2, 4, defaultThreads(), &swaps) == 0) {
+        for (uint32_t v = 0; v < graph.numVertices; v++) {
+            printf("%-16s ⇄ ", poolString(&foodNames, foods[v].name));
+            for (int j = 0; j < swaps.count[v]; j++) {
+                size_t slot = (size_t)v * swaps.maxSwaps + j;
+                printf("%s%s (%d)", j > 0 ? ", " : "", poolString(&foodNames, foods[swaps.swaps[slot]].name),
+                       swaps.depth[slot]);
+            }
+            printf("\n");
+        }
+        freeSwapTable(&swaps);
+    }
+    freeCsr(&graph);
+
+    benchmarkBfs(200000, 1000000, 20);
+    benchmarkRankedSearch(5, 10000, 50);
+    benchmarkSwapTable(swapFoods, 20, 2, 255, 5);   // 2-hop lists are longer than MAX_SWAPS: all cut off
+    benchmarkSwapTable(swapFoods, 4, 2, 255, 5);    // sparse graph: whole 2-hop lists fit
+
+    printf("\n=== CSR graph demonstration complete! ===\n\n");
+    freeStringPool(&foodNames);
+    return 0;
+}
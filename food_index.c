@@ -0,0 +1,510 @@
+// Eytzinger-Layout Sorted Array for Read-Optimized Calorie Lookups
+// NutriPlan - Data Structures Project
+// Bulk-builds a cache-friendly calorie index from Data.json and compares
+// its range-query throughput against the pointer-based BST in tree.c
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <time.h>
+
+#define MAX_JSON_SIZE (16 * 1024 * 1024)
+
+// Food row (text and nutrition) - kept out of the index key arrays
+typedef struct {
+    char name[50];
+    char hindiName[50];
+    int calories;
+    float protein;
+    float carbs;
+    float fats;
+    int cost;
+    char dietType[20];
+} FoodRow;
+
+// Growable row store; row id = position in rows[]
+typedef struct {
+    FoodRow *rows;
+    int count;
+    int capacity;
+} FoodTable;
+
+// Index key: 8 bytes, 8 keys per cache line
+typedef struct {
+    int32_t calories;
+    uint32_t rowId;
+} CalorieKey;
+
+// Read-optimized calorie index
+// eytCalories[1..n] holds the calories in Eytzinger (BFS) order so a lower
+// bound search touches one cache line per level and can prefetch ahead;
+// eytRank[k] maps an Eytzinger slot back to its position in sorted[].
+// Range results are then read from the contiguous sorted[] array.
+typedef struct {
+    int32_t *eytCalories;
+    uint32_t *eytRank;
+    CalorieKey *sorted;
+    int n;
+} CalorieIndex;
+
+// Initialize row store
+void initTable(FoodTable *table) {
+    table->rows = NULL;
+    table->count = 0;
+    table->capacity = 0;
+}
+
+// Append a row, returns its row id
+// Time Complexity: O(1) amortized
+int addRow(FoodTable *table, const char *name, const char *hindiName, int calories,
+           float protein, float carbs, float fats, int cost, const char *dietType) {
+    if (table->count == table->capacity) {
+        int newCapacity = table->capacity == 0 ? 64 : table->capacity * 2;
+        FoodRow *grown = (FoodRow*)realloc(table->rows, newCapacity * sizeof(FoodRow));
+        if (grown == NULL) {
+            printf("❌ Out of memory growing food table\n");
+            return -1;
+        }
+        table->rows = grown;
+        table->capacity = newCapacity;
+    }
+
+    FoodRow *row = &table->rows[table->count];
+    snprintf(row->name, sizeof(row->name), "%s", name);
+    snprintf(row->hindiName, sizeof(row->hindiName), "%s", hindiName);
+    row->calories = calories;
+    row->protein = protein;
+    row->carbs = carbs;
+    row->fats = fats;
+    row->cost = cost;
+    snprintf(row->dietType, sizeof(row->dietType), "%s", dietType);
+    return table->count++;
+}
+
+void freeTable(FoodTable *table) {
+    free(table->rows);
+    initTable(table);
+}
+
+// ================= MINIMAL Data.json READER =================
+// Only understands the shape of Data.json: it walks the "foods" array and
+// picks the scalar fields of each object, skipping nested arrays.
+
+typedef struct {
+    const char *p;
+    const char *end;
+} JsonCursor;
+
+void skipSpace(JsonCursor *c) {
+    while (c->p < c->end && (*c->p == ' ' || *c->p == '\n' || *c->p == '\r' ||
+                             *c->p == '\t' || *c->p == ',' || *c->p == ':')) {
+        c->p++;
+    }
+}
+
+// Copy a JSON string into out (truncating), cursor must be on the opening quote
+void readString(JsonCursor *c, char *out, int outSize) {
+    int len = 0;
+    c->p++;
+    while (c->p < c->end && *c->p != '"') {
+        if (*c->p == '\\' && c->p + 1 < c->end) c->p++;
+        if (len < outSize - 1) out[len++] = *c->p;
+        c->p++;
+    }
+    out[len] = '\0';
+    c->p++;
+}
+
+// Skip any JSON value (string, number, literal, array or object)
+void skipValue(JsonCursor *c) {
+    char tmp[8];
+    if (*c->p == '"') {
+        readString(c, tmp, sizeof(tmp));
+        return;
+    }
+    if (*c->p == '[' || *c->p == '{') {
+        int depth = 0;
+        while (c->p < c->end) {
+            if (*c->p == '"') {
+                readString(c, tmp, sizeof(tmp));
+                continue;
+            }
+            if (*c->p == '[' || *c->p == '{') depth++;
+            if (*c->p == ']' || *c->p == '}') depth--;
+            c->p++;
+            if (depth == 0) return;
+        }
+        return;
+    }
+    while (c->p < c->end && *c->p != ',' && *c->p != '}' && *c->p != ']') c->p++;
+}
+
+// Load every entry of the "foods" array into the table
+// Returns the number of foods loaded, -1 on error (message printed)
+// Time Complexity: O(file size)
+// Space Complexity: O(file size) for the read buffer
+int loadFoodsFromJson(const char *path, FoodTable *table) {
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) {
+        printf("❌ Cannot open %s\n", path);
+        return -1;
+    }
+    long fileSize = fseek(fp, 0, SEEK_END) == 0 ? ftell(fp) : -1;
+    if (fileSize < 0 || fileSize > MAX_JSON_SIZE || fseek(fp, 0, SEEK_SET) != 0) {
+        printf("❌ %s is unreadable or larger than %d MB\n", path, MAX_JSON_SIZE / (1024 * 1024));
+        fclose(fp);
+        return -1;
+    }
+    char *buffer = (char*)malloc((size_t)fileSize + 1);
+    if (buffer == NULL) {
+        printf("❌ Memory allocation failed!\n");
+        fclose(fp);
+        return -1;
+    }
+    size_t size = fread(buffer, 1, (size_t)fileSize, fp);
+    fclose(fp);
+    if (size != (size_t)fileSize) {
+        printf("❌ Cannot read %s\n", path);
+        free(buffer);
+        return -1;
+    }
+    buffer[size] = '\0';
+
+    JsonCursor c = { buffer, buffer + size };
+    const char *foods = strstr(buffer, "\"foods\"");
+    const char *array = foods != NULL ? strchr(foods, '[') : NULL;
+    if (array == NULL) {
+        printf("❌ No \"foods\" array in %s\n", path);
+        free(buffer);
+        return -1;
+    }
+    c.p = array + 1;
+
+    int loaded = 0;
+    char key[32];
+    while (1) {
+        skipSpace(&c);
+        if (c.p >= c.end || *c.p != '{') break;
+        c.p++;
+
+        FoodRow row = {"", "", 0, 0, 0, 0, 0, ""};
+        while (1) {
+            skipSpace(&c);
+            if (c.p >= c.end || *c.p == '}') break;
+            readString(&c, key, sizeof(key));
+            skipSpace(&c);
+
+            if (strcmp(key, "name") == 0) readString(&c, row.name, sizeof(row.name));
+            else if (strcmp(key, "hindiName") == 0) readString(&c, row.hindiName, sizeof(row.hindiName));
+            else if (strcmp(key, "dietType") == 0) readString(&c, row.dietType, sizeof(row.dietType));
+            else if (strcmp(key, "calories") == 0) row.calories = (int)strtol(c.p, (char**)&c.p, 10);
+            else if (strcmp(key, "protein") == 0) row.protein = strtof(c.p, (char**)&c.p);
+            else if (strcmp(key, "carbs") == 0) row.carbs = strtof(c.p, (char**)&c.p);
+            else if (strcmp(key, "fats") == 0) row.fats = strtof(c.p, (char**)&c.p);
+            else if (strcmp(key, "cost") == 0) row.cost = (int)strtol(c.p, (char**)&c.p, 10);
+            else skipValue(&c);
+        }
+        if (c.p < c.end) c.p++;
+
+        if (addRow(table, row.name, row.hindiName, row.calories, row.protein,
+                   row.carbs, row.fats, row.cost, row.dietType) < 0) {
+            free(buffer);
+            return -1;
+        }
+        loaded++;
+    }
+
+    free(buffer);
+    return loaded;
+}
+
+// ================= EYTZINGER INDEX =================
+
+int compareKeys(const void *a, const void *b) {
+    const CalorieKey *x = (const CalorieKey*)a;
+    const CalorieKey *y = (const CalorieKey*)b;
+    if (x->calories != y->calories) return x->calories < y->calories ? -1 : 1;
+    return x->rowId < y->rowId ? -1 : (x->rowId > y->rowId);
+}
+
+// Fill Eytzinger slots by an in-order walk of the implicit tree
+// Time Complexity: O(n)
+// Space Complexity: O(log n) for recursion
+int fillEytzinger(CalorieIndex *index, int sortedPos, int slot) {
+    if (slot <= index->n) {
+        sortedPos = fillEytzinger(index, sortedPos, 2 * slot);
+        index->eytCalories[slot] = index->sorted[sortedPos].calories;
+        index->eytRank[slot] = (uint32_t)sortedPos;
+        sortedPos++;
+        sortedPos = fillEytzinger(index, sortedPos, 2 * slot + 1);
+    }
+    return sortedPos;
+}
+
+void freeIndex(CalorieIndex *index) {
+    free(index->sorted);
+    free(index->eytCalories);
+    free(index->eytRank);
+    index->sorted = NULL;
+    index->eytCalories = NULL;
+    index->eytRank = NULL;
+    index->n = 0;
+}
+
+// Bulk build from a row store: sort (calories, rowId) keys, then lay them out
+// Returns 0 on success, -1 if out of memory (index left empty)
+// Time Complexity: O(n log n)
+// Space Complexity: O(n)
+int buildIndex(CalorieIndex *index, const FoodTable *table) {
+    int n = table->count;
+    index->n = n;
+    index->sorted = (CalorieKey*)malloc((n + 1) * sizeof(CalorieKey));
+    index->eytCalories = (int32_t*)aligned_alloc(64, ((n + 16) * sizeof(int32_t) + 63) / 64 * 64);
+    index->eytRank = (uint32_t*)malloc((n + 1) * sizeof(uint32_t));
+    if (index->sorted == NULL || index->eytCalories == NULL || index->eytRank == NULL) {
+        printf("❌ Out of memory building index\n");
+        freeIndex(index);
+        return -1;
+    }
+
+    for (int i = 0; i < n; i++) {
+        index->sorted[i].calories = table->rows[i].calories;
+        index->sorted[i].rowId = (uint32_t)i;
+    }
+    qsort(index->sorted, n, sizeof(CalorieKey), compareKeys);
+
+    fillEytzinger(index, 0, 1);
+    return 0;
+}
+
+// Position in sorted[] of the first key with calories >= value (n if none)
+// Branch-free descent; prefetches the slot 4 levels below the current one
+// Time Complexity: O(log n)
+// Space Complexity: O(1)
+int lowerBound(const CalorieIndex *index, int calories) {
+    unsigned k = 1;
+    while (k <= (unsigned)index->n) {
+        __builtin_prefetch(index->eytCalories + 16 * k);
+        k = 2 * k + (index->eytCalories[k] < calories);
+    }
+    k >>= __builtin_ffs(~k);  // undo the final run of right turns
+    return k == 0 ? index->n : (int)index->eytRank[k];
+}
+
+// Position in sorted[] of the first key with calories > value (n if none)
+// Same descent as lowerBound; avoids lowerBound(maxCal + 1), which
+// overflows for INT_MAX
+// Time Complexity: O(log n)
+// Space Complexity: O(1)
+int upperBound(const CalorieIndex *index, int calories) {
+    unsigned k = 1;
+    while (k <= (unsigned)index->n) {
+        __builtin_prefetch(index->eytCalories + 16 * k);
+        k = 2 * k + (index->eytCalories[k] <= calories);
+    }
+    k >>= __builtin_ffs(~k);
+    return k == 0 ? index->n : (int)index->eytRank[k];
+}
+
+// Count foods in calorie range
+// Time Complexity: O(log n)
+int countRange(const CalorieIndex *index, int minCal, int maxCal) {
+    if (minCal > maxCal) return 0;
+    return upperBound(index, maxCal) - lowerBound(index, minCal);
+}
+
+// Write row ids of foods in calorie range (ascending calories) into outRows
+// Returns the number of matches, writing at most maxOut of them
+// Time Complexity: O(log n + k)
+int rangeQuery(const CalorieIndex *index, int minCal, int maxCal,
+               uint32_t *outRows, int maxOut) {
+    int found = 0;
+    for (int i = lowerBound(index, minCal);
+         i < index->n && index->sorted[i].calories <= maxCal; i++) {
+        if (found < maxOut) outRows[found] = index->sorted[i].rowId;
+        found++;
+    }
+    return found;
+}
+
+// Print foods in calorie range, optionally filtered by diet type
+void printRange(const CalorieIndex *index, const FoodTable *table,
+                int minCal, int maxCal, const char *dietType) {
+    uint32_t rows[64];
+    int found = rangeQuery(index, minCal, maxCal, rows, 64);
+    for (int i = 0; i < found && i < 64; i++) {
+        FoodRow *row = &table->rows[rows[i]];
+        if (strcmp(dietType, "all") == 0 || strcmp(row->dietType, dietType) == 0) {
+            printf("%-25s %4d kcal | P:%.1fg | Rs.%d | %s\n",
+                   row->name, row->calories, row->protein, row->cost, row->dietType);
+        }
+    }
+}
+
+// ================= BENCHMARK: POINTER BST vs EYTZINGER =================
+
+// Pointer tree node with the same layout as tree.c's FoodNode
+typedef struct FoodNode {
+    char name[50];
+    char hindiName[50];
+    int calories;
+    float protein;
+    float carbs;
+    float fats;
+    int cost;
+    char dietType[20];
+    struct FoodNode *left;
+    struct FoodNode *right;
+} FoodNode;
+
+// Iterative insert so deep trees cannot overflow the stack
+FoodNode* insertFood(FoodNode *root, const FoodRow *row) {
+    FoodNode *newNode = (FoodNode*)malloc(sizeof(FoodNode));
+    memcpy(newNode->name, row->name, sizeof(newNode->name));
+    memcpy(newNode->hindiName, row->hindiName, sizeof(newNode->hindiName));
+    newNode->calories = row->calories;
+    newNode->protein = row->protein;
+    newNode->carbs = row->carbs;
+    newNode->fats = row->fats;
+    newNode->cost = row->cost;
+    memcpy(newNode->dietType, row->dietType, sizeof(newNode->dietType));
+    newNode->left = NULL;
+    newNode->right = NULL;
+
+    if (root == NULL) return newNode;
+    FoodNode *cur = root;
+    while (1) {
+        FoodNode **next = row->calories < cur->calories ? &cur->left : &cur->right;
+        if (*next == NULL) {
+            *next = newNode;
+            return root;
+        }
+        cur = *next;
+    }
+}
+
+// Same pruning as tree.c's countInRange
+int countInRange(FoodNode *root, int minCal, int maxCal) {
+    if (root == NULL) return 0;
+    int count = 0;
+    if (minCal < root->calories) count += countInRange(root->left, minCal, maxCal);
+    if (root->calories >= minCal && root->calories <= maxCal) count++;
+    if (maxCal >= root->calories) count += countInRange(root->right, minCal, maxCal);  // equal keys go right
+    return count;
+}
+
+void freeTree(FoodNode *root) {
+    if (root == NULL) return;
+    freeTree(root->left);
+    freeTree(root->right);
+    free(root);
+}
+
+double elapsedMs(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+// Range-query throughput on a synthetic catalogue of n foods
+// (calories 0..99999, inserted in random order so the BST stays shallow)
+void benchmarkRangeQueries(int n, int queries, int width) {
+    FoodTable table;
+    initTable(&table);
+    srand(7);
+    char name[50];
+    for (int i = 0; i < n; i++) {
+        sprintf(name, "Food %d", i);
+        addRow(&table, name, "", rand() % 100000, 10.0, 20.0, 5.0, 30, "veg");
+    }
+
+    clock_t start = clock();
+    FoodNode *bst = NULL;
+    for (int i = 0; i < n; i++) bst = insertFood(bst, &table.rows[i]);
+    double bstBuild = elapsedMs(start);
+
+    start = clock();
+    CalorieIndex index;
+    if (buildIndex(&index, &table) != 0) {
+        freeTree(bst);
+        freeTable(&table);
+        return;
+    }
+    double indexBuild = elapsedMs(start);
+
+    int *lows = (int*)malloc(queries * sizeof(int));
+    for (int q = 0; q < queries; q++) lows[q] = rand() % 100000;
+
+    long bstTotal = 0, indexTotal = 0;
+    start = clock();
+    for (int q = 0; q < queries; q++) bstTotal += countInRange(bst, lows[q], lows[q] + width);
+    double bstMs = elapsedMs(start);
+
+    uint32_t *rows = (uint32_t*)malloc(n * sizeof(uint32_t));
+    start = clock();
+    for (int q = 0; q < queries; q++) {
+        indexTotal += rangeQuery(&index, lows[q], lows[q] + width, rows, n);
+    }
+    double indexMs = elapsedMs(start);
+
+    printf("=== BENCHMARK: %d foods, %d range queries of width %d kcal ===\n", n, queries, width);
+    printf("Pointer BST : build %7.1f ms | %8.1f ms | %10.0f queries/s\n",
+           bstBuild, bstMs, queries / (bstMs / 1000.0));
+    printf("Eytzinger   : build %7.1f ms | %8.1f ms | %10.0f queries/s\n",
+           indexBuild, indexMs, queries / (indexMs / 1000.0));
+    printf("Index memory: %zu bytes/food vs %zu bytes/node\n",
+           sizeof(CalorieKey) + sizeof(int32_t) + sizeof(uint32_t), sizeof(FoodNode));
+    if (bstTotal != indexTotal) printf("❌ Result mismatch: %ld vs %ld\n", bstTotal, indexTotal);
+    printf("\n");
+
+    free(rows);
+    free(lows);
+    freeIndex(&index);
+    freeTree(bst);
+    freeTable(&table);
+}
+
+// Main function demonstrating the read-optimized index
+int main(int argc, char **argv) {
+    const char *path = argc > 1 ? argv[1] : "Data.json";
+    FoodTable table;
+    initTable(&table);
+
+    printf("=== NutriPlan Calorie Index (Eytzinger Sorted Array) ===\n\n");
+
+    int loaded = loadFoodsFromJson(path, &table);
+    if (loaded <= 0) {
+        printf("No foods loaded from %s\n", path);
+        return 1;
+    }
+    printf("Loaded %d foods from %s\n", loaded, path);
+
+    CalorieIndex index;
+    if (buildIndex(&index, &table) != 0) {
+        freeTable(&table);
+        return 1;
+    }
+
+    FoodRow *lowest = &table.rows[index.sorted[0].rowId];
+    FoodRow *highest = &table.rows[index.sorted[index.n - 1].rowId];
+    printf("Lowest Calorie: %s (%d kcal)\n", lowest->name, lowest->calories);
+    printf("Highest Calorie: %s (%d kcal)\n\n", highest->name, highest->calories);
+
+    printf("=== WEIGHT LOSS Foods (150-300 kcal, Veg) ===\n");
+    printRange(&index, &table, 150, 300, "veg");
+
+    printf("\n=== MUSCLE GAIN Foods (300-450 kcal, Non-Veg) ===\n");
+    printRange(&index, &table, 300, 450, "non-veg");
+
+    printf("\nFoods in 250-350 kcal: %d\n", countRange(&index, 250, 350));
+    printf("%s Open-ended range (>= 250 kcal, up to INT_MAX) counts %d foods\n\n",
+           countRange(&index, 250, INT_MAX) == countRange(&index, 250, 100000) ? "✅" : "❌",
+           countRange(&index, 250, INT_MAX));
+
+    freeIndex(&index);
+    freeTable(&table);
+
+    benchmarkRangeQueries(200000, 200000, 20);
+
+    return 0;
+}
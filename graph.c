@@ -5,17 +5,22 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "string_pool.h"
+#include "arena.h"
 
 #define MAX_FOODS 50
 #define MAX_QUEUE 50
 
+// Names of every food in this program, interned once
+StringPool foodNames;
+
 // Food vertex structure
 typedef struct Food {
-    char name[50];
-    char hindiName[50];
+    StringId name;
+    StringId hindiName;
     int calories;
     float protein;
-    char dietType[20];  // veg/non-veg/egg
+    uint8_t dietType;  // DietType
 } Food;
 
 // Adjacency list node
@@ -24,11 +29,23 @@ typedef struct AdjNode {
     struct AdjNode *next;
 } AdjNode;
 
+// Per-component summary, kept valid at each component's root
+typedef struct {
+    int size;
+    int minCalories;
+    int maxCalories;
+    int dietMask;  // OR of (1 << DietType) bits
+} ComponentSummary;
+
 // Graph structure
 typedef struct {
     Food foods[MAX_FOODS];
     AdjNode *adjList[MAX_FOODS];
     int numFoods;
+    int parent[MAX_FOODS];               // union-find forest over foods
+    ComponentSummary summary[MAX_FOODS]; // valid where parent[i] == i
+    int numComponents;
+    SlabPool edges;                      // every AdjNode of this graph
 } FoodGraph;
 
 // Initialize graph
@@ -36,11 +53,124 @@ typedef struct {
 // Space Complexity: O(1)
 void initGraph(FoodGraph *graph) {
     graph->numFoods = 0;
+    graph->numComponents = 0;
+    for (int i = 0; i < MAX_FOODS; i++) {
+        graph->adjList[i] = NULL;
+        graph->parent[i] = i;
+    }
+    initSlabPool(&graph->edges, sizeof(AdjNode), 2 * MAX_FOODS);
+}
+
+// Release every edge at once
+// Time Complexity: O(blocks)
+void freeGraph(FoodGraph *graph) {
+    freeSlabPool(&graph->edges);
     for (int i = 0; i < MAX_FOODS; i++) {
         graph->adjList[i] = NULL;
     }
 }
 
+// ================= CONNECTED COMPONENTS (UNION-FIND) =================
+
+// Make food its own single-member component
+// Time Complexity: O(1)
+void makeComponent(FoodGraph *graph, int food) {
+    graph->parent[food] = food;
+    graph->summary[food].size = 1;
+    graph->summary[food].minCalories = graph->foods[food].calories;
+    graph->summary[food].maxCalories = graph->foods[food].calories;
+    graph->summary[food].dietMask = 1 << graph->foods[food].dietType;
+    graph->numComponents++;
+}
+
+// Representative of food's component (path halving)
+// Time Complexity: O(α(n)) amortized
+int findComponent(FoodGraph *graph, int food) {
+    while (graph->parent[food] != food) {
+        graph->parent[food] = graph->parent[graph->parent[food]];
+        food = graph->parent[food];
+    }
+    return food;
+}
+
+// Merge the components of two foods (union by size) and their summaries
+// Time Complexity: O(α(n)) amortized
+void unionFoods(FoodGraph *graph, int food1, int food2) {
+    int a = findComponent(graph, food1);
+    int b = findComponent(graph, food2);
+    if (a == b) return;
+    if (graph->summary[a].size < graph->summary[b].size) {
+        int tmp = a;
+        a = b;
+        b = tmp;
+    }
+    graph->parent[b] = a;
+    ComponentSummary *into = &graph->summary[a];
+    const ComponentSummary *from = &graph->summary[b];
+    into->size += from->size;
+    if (from->minCalories < into->minCalories) into->minCalories = from->minCalories;
+    if (from->maxCalories > into->maxCalories) into->maxCalories = from->maxCalories;
+    into->dietMask |= from->dietMask;
+    graph->numComponents--;
+}
+
+// Can food1 be swapped for food2 through any chain of substitutes?
+// Time Complexity: O(α(n)) amortized
+int canReach(FoodGraph *graph, int food1, int food2) {
+    return findComponent(graph, food1) == findComponent(graph, food2);
+}
+
+// Summary of the component containing food
+// Time Complexity: O(α(n)) amortized
+ComponentSummary getComponentSummary(FoodGraph *graph, int food) {
+    return graph->summary[findComponent(graph, food)];
+}
+
+// Rebuild all labels from the adjacency lists (full labelling pass)
+// addEdge keeps labels current incrementally; this is for graphs whose
+// lists were edited directly
+// Time Complexity: O(V + E α(V))
+void labelComponents(FoodGraph *graph) {
+    graph->numComponents = 0;
+    for (int i = 0; i < graph->numFoods; i++) {
+        makeComponent(graph, i);
+    }
+    for (int i = 0; i < graph->numFoods; i++) {
+        for (AdjNode *temp = graph->adjList[i]; temp != NULL; temp = temp->next) {
+            unionFoods(graph, i, temp->foodIndex);
+        }
+    }
+}
+
+// Print every component with its summary
+// Time Complexity: O(V α(V) + V * C)
+void displayComponents(FoodGraph *graph) {
+    printf("\n🧩 ========================================\n");
+    printf("   SUBSTITUTION CLUSTERS (%d)\n", graph->numComponents);
+    printf("========================================\n");
+
+    int cluster = 0;
+    for (int root = 0; root < graph->numFoods; root++) {
+        if (findComponent(graph, root) != root) continue;
+        ComponentSummary s = graph->summary[root];
+        printf("Cluster %d: %d foods | %d-%d kcal | diets:%s%s%s\n", ++cluster, s.size,
+               s.minCalories, s.maxCalories,
+               s.dietMask & (1 << DIET_VEG) ? " veg" : "",
+               s.dietMask & (1 << DIET_NON_VEG) ? " non-veg" : "",
+               s.dietMask & (1 << DIET_EGG) ? " egg" : "");
+        printf("  ");
+        int first = 1;
+        for (int i = 0; i < graph->numFoods; i++) {
+            if (findComponent(graph, i) == root) {
+                printf("%s%s", first ? "" : ", ", poolString(&foodNames, graph->foods[i].name));
+                first = 0;
+            }
+        }
+        printf("\n");
+    }
+    printf("========================================\n\n");
+}
+
 // Add food vertex to graph
 // Time Complexity: O(1)
 // Space Complexity: O(1)
@@ -51,12 +181,19 @@ int addFood(FoodGraph *graph, char *name, char *hindiName, int calories,
         return -1;
     }
     
+    int diet = parseDietType(dietType);
+    if (diet == DIET_UNKNOWN || diet == DIET_ANY) {
+        printf("❌ Unknown diet type '%s'!\n", dietType);
+        return -1;
+    }
+    
     int index = graph->numFoods;
-    strcpy(graph->foods[index].name, name);
-    strcpy(graph->foods[index].hindiName, hindiName);
+    graph->foods[index].name = internString(&foodNames, name);
+    graph->foods[index].hindiName = internString(&foodNames, hindiName);
     graph->foods[index].calories = calories;
     graph->foods[index].protein = protein;
-    strcpy(graph->foods[index].dietType, dietType);
+    graph->foods[index].dietType = (uint8_t)diet;
+    makeComponent(graph, index);
     
     graph->numFoods++;
     printf("✅ Added: %s (%s) - %d kcal, %.1fg protein, %s\n", 
@@ -65,23 +202,40 @@ int addFood(FoodGraph *graph, char *name, char *hindiName, int calories,
 }
 
 // Add edge (substitution link) between two foods
-// Time Complexity: O(1)
+// Returns 0 on success, -1 on error (graph unchanged)
+// Time Complexity: O(α(n)) amortized (component merge)
 // Space Complexity: O(1)
-void addEdge(FoodGraph *graph, int food1, int food2) {
+int addEdge(FoodGraph *graph, int food1, int food2) {
+    if (food1 < 0 || food1 >= graph->numFoods || food2 < 0 || food2 >= graph->numFoods) {
+        printf("❌ Invalid food index\n");
+        return -1;
+    }
+    AdjNode *forward = (AdjNode*)slabAlloc(&graph->edges);
+    AdjNode *backward = forward != NULL ? (AdjNode*)slabAlloc(&graph->edges) : NULL;
+    if (backward == NULL) {
+        if (forward != NULL) slabFree(&graph->edges, forward);  // no half edges
+        printf("❌ Memory allocation failed!\n");
+        return -1;
+    }
+    
     // Add edge from food1 to food2
-    AdjNode *newNode = (AdjNode*)malloc(sizeof(AdjNode));
+    AdjNode *newNode = forward;
     newNode->foodIndex = food2;
     newNode->next = graph->adjList[food1];
     graph->adjList[food1] = newNode;
     
     // Add edge from food2 to food1 (undirected graph)
-    newNode = (AdjNode*)malloc(sizeof(AdjNode));
+    newNode = backward;
     newNode->foodIndex = food1;
     newNode->next = graph->adjList[food2];
     graph->adjList[food2] = newNode;
     
+    // Keep component labels current
+    unionFoods(graph, food1, food2);
+    
     printf("🔗 Linked: %s ↔ %s\n", 
-           graph->foods[food1].name, graph->foods[food2].name);
+           poolString(&foodNames, graph->foods[food1].name), poolString(&foodNames, graph->foods[food2].name));
+    return 0;
 }
 
 // Find substitutes using BFS (Breadth-First Search)
@@ -105,12 +259,12 @@ void findSubstitutes(FoodGraph *graph, int foodIndex) {
     printf("   FINDING SUBSTITUTES FOR:\n");
     printf("========================================\n");
     printf("Original: %s (%s)\n", 
-           graph->foods[foodIndex].name,
-           graph->foods[foodIndex].hindiName);
+           poolString(&foodNames, graph->foods[foodIndex].name),
+           poolString(&foodNames, graph->foods[foodIndex].hindiName));
     printf("  • %d kcal | %.1fg protein | %s\n\n", 
            graph->foods[foodIndex].calories,
            graph->foods[foodIndex].protein,
-           graph->foods[foodIndex].dietType);
+           dietTypeName(graph->foods[foodIndex].dietType));
     
     printf("AVAILABLE SWAPS:\n");
     printf("----------------------------------------\n");
@@ -130,12 +284,12 @@ void findSubstitutes(FoodGraph *graph, int foodIndex) {
                 
                 swapCount++;
                 printf("%d. %s (%s)\n", swapCount, 
-                       graph->foods[adjFood].name,
-                       graph->foods[adjFood].hindiName);
+                       poolString(&foodNames, graph->foods[adjFood].name),
+                       poolString(&foodNames, graph->foods[adjFood].hindiName));
                 printf("   • %d kcal | %.1fg protein | %s\n\n",
                        graph->foods[adjFood].calories,
                        graph->foods[adjFood].protein,
-                       graph->foods[adjFood].dietType);
+                       dietTypeName(graph->foods[adjFood].dietType));
             }
             
             temp = temp->next;
@@ -160,7 +314,7 @@ void displayGraph(FoodGraph *graph) {
     printf("========================================\n\n");
     
     for (int i = 0; i < graph->numFoods; i++) {
-        printf("%s → ", graph->foods[i].name);
+        printf("%s → ", poolString(&foodNames, graph->foods[i].name));
         
         AdjNode *temp = graph->adjList[i];
         if (temp == NULL) {
@@ -170,7 +324,7 @@ void displayGraph(FoodGraph *graph) {
         int count = 0;
         while (temp != NULL) {
             if (count > 0) printf(", ");
-            printf("%s", graph->foods[temp->foodIndex].name);
+            printf("%s", poolString(&foodNames, graph->foods[temp->foodIndex].name));
             temp = temp->next;
             count++;
         }
@@ -184,13 +338,19 @@ void findByDietType(FoodGraph *graph, char *dietType) {
     printf("\n📋 Foods with diet type '%s':\n", dietType);
     printf("----------------------------------------\n");
     
+    int diet = parseDietType(dietType);  // resolved once, integer compares below
+    if (diet == DIET_UNKNOWN) {
+        printf("❌ Unknown diet type '%s'!\n", dietType);
+        printf("----------------------------------------\n\n");
+        return;
+    }
     int found = 0;
     for (int i = 0; i < graph->numFoods; i++) {
-        if (strcmp(graph->foods[i].dietType, dietType) == 0) {
+        if (diet == DIET_ANY || graph->foods[i].dietType == diet) {
             printf("%d. %s (%s) - %d kcal\n", 
                    found + 1,
-                   graph->foods[i].name,
-                   graph->foods[i].hindiName,
+                   poolString(&foodNames, graph->foods[i].name),
+                   poolString(&foodNames, graph->foods[i].hindiName),
                    graph->foods[i].calories);
             found++;
         }
@@ -232,7 +392,9 @@ int getDegree(FoodGraph *graph, int foodIndex) {
 // Main function demonstrating Graph operations
 int main() {
     FoodGraph graph;
+    if (initStringPool(&foodNames) != 0) return 1;
     initGraph(&graph);
+    setAllocHook(&graph.edges.arena, printAllocStats, "edge pool");
     
     printf("\n=== NutriPlan Food Substitution Network (Graph) ===\n\n");
     
@@ -266,10 +428,17 @@ int main() {
     addEdge(&graph, dal, rajma);
     addEdge(&graph, dal, tofu);
     
+    // Clusters before any cross-category link
+    printf("Clusters so far: %d | Chicken ↔ Dal %s\n", graph.numComponents,
+           canReach(&graph, chicken, dal) ? "reachable" : "not reachable");
+    
     // Cross-category protein sources
     addEdge(&graph, tofu, soya);
     addEdge(&graph, egg, paneer);
     addEdge(&graph, chole, rajma);
+
+    // A link to a food that was never added is refused
+    printf("%s Link to unknown food refused\n", addEdge(&graph, paneer, -1) != 0 ? "✅" : "❌");
     
     // Display network
     displayGraph(&graph);
@@ -292,6 +461,26 @@ int main() {
     printf("Can Egg substitute Paneer? %s\n\n", 
            areConnected(&graph, egg, paneer) ? "✅ Yes" : "❌ No");
     
+    // Reachability through chains of swaps (union-find, no traversal)
+    printf("--- CHECKING REACHABILITY (same cluster) ---\n");
+    printf("Can Chicken reach Dal? %s\n", 
+           canReach(&graph, chicken, dal) ? "✅ Yes" : "❌ No");
+    printf("Can Fish reach Rajma? %s\n", 
+           canReach(&graph, fish, rajma) ? "✅ Yes" : "❌ No");
+    printf("Can Mushroom reach Chole? %s\n", 
+           canReach(&graph, mushroom, chole) ? "✅ Yes" : "❌ No");
+    
+    ComponentSummary dalCluster = getComponentSummary(&graph, dal);
+    printf("Dal's cluster: %d foods, %d-%d kcal\n", 
+           dalCluster.size, dalCluster.minCalories, dalCluster.maxCalories);
+    
+    displayComponents(&graph);
+    
+    // Full relabelling pass gives the same clusters
+    labelComponents(&graph);
+    printf("After full relabel: %d clusters, Chicken ↔ Dal %s\n\n", graph.numComponents,
+           canReach(&graph, chicken, dal) ? "reachable" : "not reachable");
+    
     // Show most versatile food (highest degree)
     printf("--- FINDING MOST VERSATILE FOODS ---\n");
     printf("(Foods with most substitution options)\n\n");
@@ -299,7 +488,7 @@ int main() {
     for (int i = 0; i < graph.numFoods; i++) {
         int degree = getDegree(&graph, i);
         if (degree >= 3) {
-            printf("🌟 %s: %d substitutes\n", graph.foods[i].name, degree);
+            printf("🌟 %s: %d substitutes\n", poolString(&foodNames, graph.foods[i].name), degree);
         }
     }
     
@@ -307,5 +496,10 @@ int main() {
     printf("Key features: BFS traversal finds all connected substitutes\n");
     printf("Use case: 'Swap Meal' button uses this graph to find alternatives\n\n");
     
+    printf("Food record: %zu bytes (was %zu with char[50]/char[50]/char[20] strings)\n\n",
+           sizeof(Food), 2 * 50 + sizeof(int) + sizeof(float) + 20);
+    
+    freeGraph(&graph);
+    freeStringPool(&foodNames);
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,382 @@
+// Indexed Priority Queue (d-ary Max Heap with Position Map)
+// NutriPlan - Data Structures Project
+// Re-ranks meals in place when a goal or price changes: updateScore and
+// remove by handle in O(log n) instead of rebuilding the whole queue
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "meal_scoring.h"   // calculateScore
+
+#define NOT_QUEUED -1
+
+// Heap slot: score next to its handle so child comparisons stay in one cache line
+typedef struct {
+    int score;
+    uint32_t handle;
+} HeapEntry;
+
+// Max heap of handles (e.g. catalogue row ids)
+// position[handle] is the slot of that handle in heap[], or NOT_QUEUED
+typedef struct {
+    HeapEntry *heap;
+    int32_t *position;
+    int size;
+    int capacity;     // handles accepted: 0 .. capacity-1
+    int arity;        // 2 (binary) or 4 (4-ary, shallower and cache friendlier)
+} IndexedPQ;
+
+void freeIndexedPQ(IndexedPQ *pq) {
+    free(pq->heap);
+    free(pq->position);
+    pq->heap = NULL;
+    pq->position = NULL;
+    pq->size = pq->capacity = 0;
+}
+
+// Initialize queue for handles 0 .. capacity-1
+// Returns 0 on success, -1 if out of memory (queue left empty)
+// Time Complexity: O(capacity)
+// Space Complexity: O(capacity)
+int initIndexedPQ(IndexedPQ *pq, int capacity, int arity) {
+    pq->heap = (HeapEntry*)malloc((capacity > 0 ? capacity : 1) * sizeof(HeapEntry));
+    pq->position = (int32_t*)malloc((capacity > 0 ? capacity : 1) * sizeof(int32_t));
+    if (pq->heap == NULL || pq->position == NULL) {
+        printf("❌ Out of memory creating queue\n");
+        freeIndexedPQ(pq);
+        return -1;
+    }
+    for (int i = 0; i < capacity; i++) pq->position[i] = NOT_QUEUED;
+    pq->size = 0;
+    pq->capacity = capacity;
+    pq->arity = arity == 4 ? 4 : 2;
+    return 0;
+}
+
+int isQueued(IndexedPQ *pq, uint32_t handle) {
+    return handle < (uint32_t)pq->capacity && pq->position[handle] != NOT_QUEUED;
+}
+
+// Move the hole at index up until entry fits, then place it
+// Time Complexity: O(log_d n)
+void siftUp(IndexedPQ *pq, int index, HeapEntry entry) {
+    while (index > 0) {
+        int parent = (index - 1) / pq->arity;
+        if (pq->heap[parent].score >= entry.score) break;
+        pq->heap[index] = pq->heap[parent];
+        pq->position[pq->heap[index].handle] = index;
+        index = parent;
+    }
+    pq->heap[index] = entry;
+    pq->position[entry.handle] = index;
+}
+
+// Move the hole at index down until entry fits, then place it
+// Time Complexity: O(d log_d n)
+void siftDown(IndexedPQ *pq, int index, HeapEntry entry) {
+    while (1) {
+        int first = pq->arity * index + 1;
+        if (first >= pq->size) break;
+        int last = first + pq->arity < pq->size ? first + pq->arity : pq->size;
+        int best = first;
+        for (int c = first + 1; c < last; c++) {
+            if (pq->heap[c].score > pq->heap[best].score) best = c;
+        }
+        if (pq->heap[best].score <= entry.score) break;
+        pq->heap[index] = pq->heap[best];
+        pq->position[pq->heap[index].handle] = index;
+        index = best;
+    }
+    pq->heap[index] = entry;
+    pq->position[entry.handle] = index;
+}
+
+// Insert handle with score (fails if already queued or out of range)
+// Time Complexity: O(log n)
+int pushHandle(IndexedPQ *pq, uint32_t handle, int score) {
+    if (handle >= (uint32_t)pq->capacity || pq->position[handle] != NOT_QUEUED) {
+        printf("❌ Handle %u is invalid or already queued\n", handle);
+        return -1;
+    }
+    HeapEntry entry = { score, handle };
+    siftUp(pq, pq->size++, entry);
+    return 0;
+}
+
+// Change the score of a queued handle (goal switch, price update)
+// Time Complexity: O(log n)
+int updateScore(IndexedPQ *pq, uint32_t handle, int newScore) {
+    if (!isQueued(pq, handle)) return -1;
+    int index = pq->position[handle];
+    HeapEntry entry = { newScore, handle };
+    if (newScore > pq->heap[index].score) siftUp(pq, index, entry);
+    else siftDown(pq, index, entry);
+    return 0;
+}
+
+// Remove a queued handle from anywhere in the heap
+// Time Complexity: O(log n)
+int removeHandle(IndexedPQ *pq, uint32_t handle) {
+    if (!isQueued(pq, handle)) return -1;
+    int index = pq->position[handle];
+    pq->position[handle] = NOT_QUEUED;
+    HeapEntry last = pq->heap[--pq->size];
+    if (index == pq->size) return 0;  // removed the last slot
+
+    // The last entry fills the hole; it may need to go either way
+    if (index > 0 && last.score > pq->heap[(index - 1) / pq->arity].score) siftUp(pq, index, last);
+    else siftDown(pq, index, last);
+    return 0;
+}
+
+// Extract the best handle; returns -1 when empty
+// Time Complexity: O(log n)
+int64_t popMax(IndexedPQ *pq, int *score) {
+    if (pq->size == 0) return -1;
+    HeapEntry top = pq->heap[0];
+    pq->position[top.handle] = NOT_QUEUED;
+    HeapEntry last = pq->heap[--pq->size];
+    if (pq->size > 0) siftDown(pq, 0, last);
+    if (score != NULL) *score = top.score;
+    return top.handle;
+}
+
+int getScore(IndexedPQ *pq, uint32_t handle) {
+    return isQueued(pq, handle) ? pq->heap[pq->position[handle]].score : 0;
+}
+
+// ================= BASELINE: priority_queue.c HEAP =================
+
+#define MAX_SIZE 100
+
+typedef struct {
+    char name[50];
+    char hindiName[50];
+    int calories;
+    float protein;
+    float carbs;
+    float fats;
+    int cost;
+    int score;
+} Meal;
+
+typedef struct {
+    Meal heap[MAX_SIZE];
+    int size;
+} PriorityQueue;
+
+void swap(Meal *a, Meal *b) {
+    Meal temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+void heapifyUp(PriorityQueue *pq, int index) {
+    if (index == 0) return;
+    int parent = (index - 1) / 2;
+    if (pq->heap[index].score > pq->heap[parent].score) {
+        swap(&pq->heap[index], &pq->heap[parent]);
+        heapifyUp(pq, parent);
+    }
+}
+
+void heapifyDown(PriorityQueue *pq, int index) {
+    int largest = index;
+    int left = 2 * index + 1;
+    int right = 2 * index + 2;
+    if (left < pq->size && pq->heap[left].score > pq->heap[largest].score) largest = left;
+    if (right < pq->size && pq->heap[right].score > pq->heap[largest].score) largest = right;
+    if (largest != index) {
+        swap(&pq->heap[index], &pq->heap[largest]);
+        heapifyDown(pq, largest);
+    }
+}
+
+void insertMeal(PriorityQueue *pq, Meal *meal) {
+    if (pq->size >= MAX_SIZE) return;
+    pq->heap[pq->size] = *meal;
+    heapifyUp(pq, pq->size);
+    pq->size++;
+}
+
+Meal extractMax(PriorityQueue *pq) {
+    Meal maxMeal = pq->heap[0];
+    pq->heap[0] = pq->heap[pq->size - 1];
+    pq->size--;
+    heapifyDown(pq, 0);
+    return maxMeal;
+}
+
+// ================= MICROBENCHMARK =================
+
+double elapsedMs(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+// Price/score changes on a full 100-meal queue: today the queue is rebuilt
+// after every change; the indexed queue updates one handle in place
+void benchmarkUpdates(int updates) {
+    Meal meals[MAX_SIZE];
+    int *newScores = (int*)malloc(updates * sizeof(int));
+    for (int u = 0; u < updates; u++) newScores[u] = rand() % 1000;
+    for (int i = 0; i < MAX_SIZE; i++) {
+        memset(&meals[i], 0, sizeof(Meal));
+        sprintf(meals[i].name, "Meal %d", i);
+        meals[i].score = rand() % 1000;
+    }
+
+    IndexedPQ ipq;
+    if (initIndexedPQ(&ipq, MAX_SIZE, 4) != 0) {
+        free(newScores);
+        return;
+    }
+    for (int i = 0; i < MAX_SIZE; i++) pushHandle(&ipq, (uint32_t)i, meals[i].score);
+
+    PriorityQueue *pq = (PriorityQueue*)malloc(sizeof(PriorityQueue));
+    long checksum = 0;
+    clock_t start = clock();
+    for (int u = 0; u < updates; u++) {
+        meals[u % MAX_SIZE].score = newScores[u];
+        pq->size = 0;
+        for (int i = 0; i < MAX_SIZE; i++) insertMeal(pq, &meals[i]);
+        checksum += pq->heap[0].score;
+    }
+    double rebuildMs = elapsedMs(start);
+
+    long checksumIndexed = 0;
+    start = clock();
+    for (int u = 0; u < updates; u++) {
+        updateScore(&ipq, (uint32_t)(u % MAX_SIZE), newScores[u]);
+        checksumIndexed += ipq.heap[0].score;
+    }
+    double indexedMs = elapsedMs(start);
+
+    printf("=== BENCHMARK: %d score updates on a %d-meal queue ===\n", updates, MAX_SIZE);
+    printf("Rebuild Meal heap     : %8.1f ms\n", rebuildMs);
+    printf("Indexed updateScore   : %8.1f ms\n", indexedMs);
+    printf("Same best scores: %s\n\n", checksum == checksumIndexed ? "Yes" : "No");
+
+    freeIndexedPQ(&ipq);
+    free(pq);
+    free(newScores);
+}
+
+// Drain the indexed heap, checking scores come out in non-increasing order
+int drainOrdered(IndexedPQ *pq) {
+    int previous = 0x7fffffff, ordered = 1, score;
+    while (pq->size > 0) {
+        popMax(pq, &score);
+        if (score > previous) ordered = 0;
+        previous = score;
+    }
+    return ordered;
+}
+
+// Push then pop n meals: first in rounds of MAX_SIZE (the Meal heap's cap)
+// for both queues, then the indexed heap holding all n at once with the
+// binary and 4-ary layouts
+void benchmarkPushPop(int n) {
+    int *scores = (int*)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) scores[i] = rand();
+
+    PriorityQueue *pq = (PriorityQueue*)malloc(sizeof(PriorityQueue));
+    Meal meal;
+    memset(&meal, 0, sizeof(Meal));
+    clock_t start = clock();
+    for (int base = 0; base < n; base += MAX_SIZE) {
+        pq->size = 0;
+        for (int i = base; i < n && i < base + MAX_SIZE; i++) {
+            meal.score = scores[i];
+            insertMeal(pq, &meal);
+        }
+        while (pq->size > 0) extractMax(pq);
+    }
+    double mealMs = elapsedMs(start);
+
+    IndexedPQ ipq;
+    if (initIndexedPQ(&ipq, MAX_SIZE, 4) != 0) {
+        free(scores);
+        free(pq);
+        return;
+    }
+    int ordered = 1;
+    start = clock();
+    for (int base = 0; base < n; base += MAX_SIZE) {
+        for (int i = base; i < n && i < base + MAX_SIZE; i++) {
+            pushHandle(&ipq, (uint32_t)(i - base), scores[i]);
+        }
+        ordered &= drainOrdered(&ipq);
+    }
+    double indexedMs = elapsedMs(start);
+    freeIndexedPQ(&ipq);
+
+    printf("=== BENCHMARK: push + pop %d meals ===\n", n);
+    printf("Rounds of %d, Meal heap      : %8.1f ms\n", MAX_SIZE, mealMs);
+    printf("Rounds of %d, indexed 4-ary  : %8.1f ms\n", MAX_SIZE, indexedMs);
+
+    for (int arity = 2; arity <= 4; arity += 2) {
+        if (initIndexedPQ(&ipq, n, arity) != 0) break;
+        start = clock();
+        for (int i = 0; i < n; i++) pushHandle(&ipq, (uint32_t)i, scores[i]);
+        ordered &= drainOrdered(&ipq);
+        printf("All %d, indexed %d-ary  : %8.1f ms\n", n, arity, elapsedMs(start));
+        freeIndexedPQ(&ipq);
+    }
+    if (!ordered) printf("❌ Indexed heap popped out of order\n");
+    printf("\n");
+
+    free(scores);
+    free(pq);
+}
+
+// Main function demonstrating the indexed priority queue
+int main() {
+    char *names[] = { "Moong Dal Cheela", "Paneer Bhurji", "Chicken Curry", "Poha",
+                      "Egg Curry", "Dal Tadka", "Chole" };
+    int calories[] = { 180, 265, 380, 250, 350, 320, 420 };
+    float protein[] = { 12.0, 18.5, 32.0, 6.0, 20.0, 14.0, 18.0 };
+    float carbs[] = { 25.0, 8.0, 12.0, 40.0, 18.0, 48.0, 65.0 };
+    int numMeals = 7;
+
+    printf("=== NutriPlan Indexed Meal Ranking (d-ary Heap + Position Map) ===\n\n");
+
+    IndexedPQ pq;
+    if (initIndexedPQ(&pq, numMeals, 4) != 0) return 1;
+
+    char goal[] = "weight-loss";
+    for (int i = 0; i < numMeals; i++) {
+        pushHandle(&pq, (uint32_t)i, calculateScore(goal, calories[i], protein[i], carbs[i]));
+    }
+    printf("Queued %d meals for %s, best: %s (score %d)\n",
+           pq.size, goal, names[pq.heap[0].handle], pq.heap[0].score);
+
+    // User switches goal: rescore every meal in place, no rebuild
+    char newGoal[] = "muscle-gain";
+    for (int i = 0; i < numMeals; i++) {
+        updateScore(&pq, (uint32_t)i, calculateScore(newGoal, calories[i], protein[i], carbs[i]));
+    }
+    printf("Goal changed to %s, best: %s (score %d)\n",
+           newGoal, names[pq.heap[0].handle], pq.heap[0].score);
+
+    // Chicken price spikes: penalize it; Poha goes out of stock: remove it
+    updateScore(&pq, 2, getScore(&pq, 2) - 60);
+    removeHandle(&pq, 3);
+    printf("After Chicken Curry penalty and removing Poha: %d meals queued\n", pq.size);
+
+    printf("\nTOP 3 Meals for Muscle Gain:\n");
+    for (int rank = 1; rank <= 3 && pq.size > 0; rank++) {
+        int score;
+        int64_t handle = popMax(&pq, &score);
+        printf("#%d: %-18s score %d\n", rank, names[handle], score);
+    }
+    printf("\n");
+    freeIndexedPQ(&pq);
+
+    srand(42);
+    benchmarkUpdates(200000);
+    benchmarkPushPop(1000000);
+
+    return 0;
+}
@@ -0,0 +1,386 @@
+// Append-Only Journal Format (.journal / .snapshot)
+// NutriPlan - Data Structures Project
+// Sin-stack and meal-log changes are appended as small binary records
+// instead of re-serializing the whole history on every change. A
+// snapshot uses the same format and holds the compacted state; the
+// journal holds the changes made since that snapshot.
+//
+// File = JournalHeader, then records:
+//   RecordHeader { length, crc, type } + payload[length]
+// crc is CRC-32 of type and payload, so a torn or corrupted tail record
+// is detected on replay and cut off. A journal is only replayed on top
+// of the snapshot with the same generation number; compaction writes the
+// snapshot first and the new journal second, so a crash between the two
+// leaves a stale journal that is ignored rather than applied twice.
+// All integers are little-endian.
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <libgen.h>
+#include <sys/stat.h>
+
+#define JOURNAL_MAGIC "NPJRNL\0\0"
+#define JOURNAL_VERSION 1
+#define JOURNAL_MAX_NAME 255
+#define JOURNAL_MAX_PAYLOAD 528   // room for the largest sin: SinPayload + two full names
+
+// Record types
+enum {
+    JR_SIN_PUSH = 1,   // SinPayload + name + icon
+    JR_SIN_POP,        // no payload
+    JR_SIN_CLEAR,      // no payload
+    JR_MEAL_LOG        // MealPayload + name
+};
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t headerSize;
+    uint64_t generation;   // snapshot this journal applies to
+} JournalHeader;
+
+typedef struct {
+    uint32_t length;       // payload bytes
+    uint32_t crc;          // CRC-32 of type byte + payload
+    uint8_t type;
+    uint8_t reserved[3];
+} RecordHeader;
+
+typedef struct {
+    int64_t eatenAt;       // seconds since the epoch
+    int32_t calories;
+    uint16_t nameLength;
+    uint16_t iconLength;
+} SinPayload;
+
+typedef struct {
+    int64_t loggedAt;      // seconds since the epoch
+    int32_t calories;
+    float protein;
+    float carbs;
+    uint16_t nameLength;
+    uint16_t reserved;
+} MealPayload;
+
+// Decoded record handed to replay callbacks (strings NUL-terminated)
+typedef struct {
+    int type;
+    int64_t time;
+    int32_t calories;
+    float protein;
+    float carbs;
+    char name[JOURNAL_MAX_NAME + 1];
+    char icon[JOURNAL_MAX_NAME + 1];
+} JournalEntry;
+
+// When appended records are forced to disk
+typedef enum {
+    SYNC_NONE,     // leave it to the OS (survives a process crash, not power loss)
+    SYNC_BATCH,    // fsync once every batchSize records and on journalSync/close
+    SYNC_ALWAYS    // fsync after every record
+} SyncPolicy;
+
+// Open journal (or snapshot being written) in append mode
+typedef struct {
+    int fd;
+    uint64_t generation;
+    SyncPolicy policy;
+    int batchSize;
+    int pending;           // records written since the last fsync
+    uint64_t size;         // bytes in the file
+    uint64_t records;      // records appended through this handle
+    uint64_t syncs;        // fsync calls
+    int failed;            // a write or fsync failed and could not be undone
+} Journal;
+
+// ================= CRC-32 =================
+
+static inline uint32_t journalCrc(uint32_t crc, const uint8_t *data, size_t length) {
+    static uint32_t table[256];
+    static int ready = 0;
+    if (!ready) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+        ready = 1;
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+// ================= WRITING =================
+
+// fsync the directory holding path so a rename or create is durable
+static inline void journalSyncDir(const char *path) {
+    char copy[1024];
+    snprintf(copy, sizeof(copy), "%s", path);
+    int fd = open(dirname(copy), O_RDONLY);
+    if (fd >= 0) {
+        fsync(fd);
+        close(fd);
+    }
+}
+
+// Create (truncate) path with a fresh header and open it for appending
+// Returns 0 on success, -1 on error (message printed)
+static inline int journalCreate(Journal *j, const char *path, uint64_t generation,
+                                SyncPolicy policy, int batchSize) {
+    memset(j, 0, sizeof(Journal));
+    j->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (j->fd < 0) {
+        printf("❌ Cannot create journal %s\n", path);
+        return -1;
+    }
+    JournalHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, JOURNAL_MAGIC, 8);
+    header.version = JOURNAL_VERSION;
+    header.headerSize = sizeof(JournalHeader);
+    header.generation = generation;
+    if (write(j->fd, &header, sizeof(header)) != (ssize_t)sizeof(header)) {
+        printf("❌ Cannot write journal header to %s\n", path);
+        close(j->fd);
+        j->fd = -1;
+        return -1;
+    }
+    j->generation = generation;
+    j->policy = policy;
+    j->batchSize = batchSize > 0 ? batchSize : 1;
+    j->size = sizeof(header);
+    j->pending = 1;  // the header is not on disk yet
+    return 0;
+}
+
+// Reopen an existing journal for appending after its last valid record
+// (validSize from journalReplay); anything after it - a torn write - is cut off
+// Returns 0 on success, -1 on error (message printed)
+static inline int journalReopen(Journal *j, const char *path, uint64_t generation,
+                                uint64_t validSize, SyncPolicy policy, int batchSize) {
+    memset(j, 0, sizeof(Journal));
+    j->fd = open(path, O_WRONLY);
+    if (j->fd < 0 || ftruncate(j->fd, (off_t)validSize) != 0 ||
+        lseek(j->fd, (off_t)validSize, SEEK_SET) < 0) {
+        printf("❌ Cannot reopen journal %s\n", path);
+        if (j->fd >= 0) close(j->fd);
+        j->fd = -1;
+        return -1;
+    }
+    j->generation = generation;
+    j->policy = policy;
+    j->batchSize = batchSize > 0 ? batchSize : 1;
+    j->size = validSize;
+    return 0;
+}
+
+// Force everything appended so far to disk
+static inline int journalSync(Journal *j) {
+    if (j->pending == 0) return 0;
+    j->pending = 0;
+    j->syncs++;
+    if (fsync(j->fd) != 0) {
+        // The kernel may have dropped the dirty pages; nothing after this is trustworthy
+        printf("❌ Journal fsync failed\n");
+        j->failed = 1;
+        return -1;
+    }
+    return 0;
+}
+
+// Append one record with a single write(). A short or failed write is
+// cut back off the file so the next record does not land after garbage;
+// if that fails too, the handle refuses every further append
+// Returns 0 on success, -1 on error (message printed)
+// Time Complexity: O(record size)
+static inline int journalAppend(Journal *j, int type, const void *payload, uint32_t length) {
+    uint8_t buffer[sizeof(RecordHeader) + JOURNAL_MAX_PAYLOAD];
+    if (j->failed) {
+        printf("❌ Journal is unusable after an earlier write failure\n");
+        return -1;
+    }
+    if (length > JOURNAL_MAX_PAYLOAD) {
+        printf("❌ Journal record too large (%u bytes)\n", length);
+        return -1;
+    }
+    RecordHeader header;
+    memset(&header, 0, sizeof(header));
+    header.length = length;
+    header.type = (uint8_t)type;
+    header.crc = journalCrc(journalCrc(0, &header.type, 1), (const uint8_t*)payload, length);
+    memcpy(buffer, &header, sizeof(header));
+    if (length > 0) memcpy(buffer + sizeof(header), payload, length);
+
+    size_t total = sizeof(header) + length;
+    if (write(j->fd, buffer, total) != (ssize_t)total) {
+        printf("❌ Journal write failed\n");
+        if (ftruncate(j->fd, (off_t)j->size) != 0 || lseek(j->fd, (off_t)j->size, SEEK_SET) < 0) {
+            j->failed = 1;
+        }
+        return -1;
+    }
+    j->size += total;
+    j->records++;
+    j->pending++;
+    if (j->policy == SYNC_ALWAYS || (j->policy == SYNC_BATCH && j->pending >= j->batchSize)) {
+        return journalSync(j);
+    }
+    return 0;
+}
+
+static inline int journalAppendSin(Journal *j, int64_t eatenAt, int32_t calories,
+                                   const char *name, const char *icon) {
+    uint8_t payload[JOURNAL_MAX_PAYLOAD];
+    SinPayload sin;
+    size_t nameLength = strlen(name), iconLength = strlen(icon);
+    if (nameLength > JOURNAL_MAX_NAME) nameLength = JOURNAL_MAX_NAME;
+    if (iconLength > JOURNAL_MAX_NAME) iconLength = JOURNAL_MAX_NAME;  // same limit as journalDecode
+    memset(&sin, 0, sizeof(sin));
+    sin.eatenAt = eatenAt;
+    sin.calories = calories;
+    sin.nameLength = (uint16_t)nameLength;
+    sin.iconLength = (uint16_t)iconLength;
+    memcpy(payload, &sin, sizeof(sin));
+    memcpy(payload + sizeof(sin), name, nameLength);
+    memcpy(payload + sizeof(sin) + nameLength, icon, iconLength);
+    return journalAppend(j, JR_SIN_PUSH, payload, (uint32_t)(sizeof(sin) + nameLength + iconLength));
+}
+
+static inline int journalAppendMeal(Journal *j, int64_t loggedAt, int32_t calories,
+                                    float protein, float carbs, const char *name) {
+    uint8_t payload[JOURNAL_MAX_PAYLOAD];
+    MealPayload meal;
+    size_t nameLength = strlen(name);
+    if (nameLength > JOURNAL_MAX_NAME) nameLength = JOURNAL_MAX_NAME;
+    memset(&meal, 0, sizeof(meal));
+    meal.loggedAt = loggedAt;
+    meal.calories = calories;
+    meal.protein = protein;
+    meal.carbs = carbs;
+    meal.nameLength = (uint16_t)nameLength;
+    memcpy(payload, &meal, sizeof(meal));
+    memcpy(payload + sizeof(meal), name, nameLength);
+    return journalAppend(j, JR_MEAL_LOG, payload, (uint32_t)(sizeof(meal) + nameLength));
+}
+
+static inline void journalClose(Journal *j) {
+    if (j->fd < 0) return;
+    if (j->policy != SYNC_NONE) journalSync(j);
+    close(j->fd);
+    j->fd = -1;
+}
+
+// Finish a file written to tmpPath (e.g. a snapshot): fsync, close and
+// atomically rename it over path
+// Returns 0 on success, -1 on error (message printed)
+static inline int journalCommit(Journal *j, const char *tmpPath, const char *path) {
+    int failed = j->failed || fsync(j->fd) != 0;
+    close(j->fd);
+    j->fd = -1;
+    if (failed || rename(tmpPath, path) != 0) {
+        printf("❌ Cannot commit %s\n", path);
+        unlink(tmpPath);
+        return -1;
+    }
+    journalSyncDir(path);
+    return 0;
+}
+
+// ================= REPLAY =================
+
+// Decode one record's payload; returns 0 if it is well-formed
+static inline int journalDecode(int type, const uint8_t *payload, uint32_t length, JournalEntry *e) {
+    memset(e, 0, sizeof(JournalEntry));
+    e->type = type;
+    if (type == JR_SIN_POP || type == JR_SIN_CLEAR) return length == 0 ? 0 : -1;
+    if (type == JR_SIN_PUSH) {
+        SinPayload sin;
+        if (length < sizeof(sin)) return -1;
+        memcpy(&sin, payload, sizeof(sin));
+        if (sizeof(sin) + sin.nameLength + sin.iconLength != length ||
+            sin.nameLength > JOURNAL_MAX_NAME || sin.iconLength > JOURNAL_MAX_NAME) return -1;
+        e->time = sin.eatenAt;
+        e->calories = sin.calories;
+        memcpy(e->name, payload + sizeof(sin), sin.nameLength);
+        memcpy(e->icon, payload + sizeof(sin) + sin.nameLength, sin.iconLength);
+        return 0;
+    }
+    if (type == JR_MEAL_LOG) {
+        MealPayload meal;
+        if (length < sizeof(meal)) return -1;
+        memcpy(&meal, payload, sizeof(meal));
+        if (sizeof(meal) + meal.nameLength != length || meal.nameLength > JOURNAL_MAX_NAME) return -1;
+        e->time = meal.loggedAt;
+        e->calories = meal.calories;
+        e->protein = meal.protein;
+        e->carbs = meal.carbs;
+        memcpy(e->name, payload + sizeof(meal), meal.nameLength);
+        return 0;
+    }
+    return -1;
+}
+
+// Generation number of the journal at path
+// Returns 0 on success, -1 if the file is missing or not a journal
+static inline int journalGeneration(const char *path, uint64_t *generation) {
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) return -1;
+    JournalHeader header;
+    int valid = fread(&header, sizeof(header), 1, fp) == 1 &&
+                memcmp(header.magic, JOURNAL_MAGIC, 8) == 0 && header.version == JOURNAL_VERSION &&
+                header.headerSize == sizeof(JournalHeader);
+    fclose(fp);
+    if (!valid) return -1;
+    *generation = header.generation;
+    return 0;
+}
+
+typedef void (*JournalCallback)(void *ctx, const JournalEntry *entry);
+
+// Replay every valid record of path in order, stopping at the first
+// truncated or corrupted one. *generation gets the header's generation,
+// *validSize the offset just past the last valid record
+// Returns the number of records replayed, -1 if the file is missing or
+// not a journal (nothing replayed)
+// Time Complexity: O(file size)
+static inline long journalReplay(const char *path, JournalCallback callback, void *ctx,
+                                 uint64_t *generation, uint64_t *validSize) {
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) return -1;
+    JournalHeader header;
+    if (fread(&header, sizeof(header), 1, fp) != 1 ||
+        memcmp(header.magic, JOURNAL_MAGIC, 8) != 0 || header.version != JOURNAL_VERSION ||
+        header.headerSize != sizeof(JournalHeader)) {
+        fclose(fp);
+        return -1;
+    }
+    *generation = header.generation;
+    *validSize = sizeof(header);
+
+    long count = 0;
+    RecordHeader record;
+    uint8_t payload[JOURNAL_MAX_PAYLOAD];
+    JournalEntry entry;
+    while (fread(&record, sizeof(record), 1, fp) == 1) {
+        if (record.length > JOURNAL_MAX_PAYLOAD ||
+            (record.length > 0 && fread(payload, record.length, 1, fp) != 1) ||
+            journalCrc(journalCrc(0, &record.type, 1), payload, record.length) != record.crc ||
+            journalDecode(record.type, payload, record.length, &entry) != 0) {
+            break;
+        }
+        callback(ctx, &entry);
+        *validSize += sizeof(record) + record.length;
+        count++;
+    }
+    fclose(fp);
+    return count;
+}
+
+#endif
@@ -0,0 +1,771 @@
+// Streaming (SAX-Style) JSON Loader for Data.json Catalogues
+// NutriPlan - Data Structures Project
+// Reads foods, junkFoods and recipe steps in fixed-size chunks and fills
+// records straight into an arena: no DOM, no malloc per string, and
+// bounded memory for catalogues of hundreds of MB
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "arena.h"
+
+#define READ_CHUNK (64 * 1024)       // bytes read from disk per refill
+#define MAX_TOKEN (1024 * 1024)      // longest string the tokenizer accepts
+#define MAX_NESTING 64
+#define ARENA_BLOCK (256 * 1024)
+
+// Goal tag bits (Data.json "goal" array)
+#define GOAL_WEIGHT_LOSS  0x01
+#define GOAL_MUSCLE_GAIN  0x02
+#define GOAL_MAINTAIN     0x04
+#define GOAL_PCOD         0x08
+#define GOAL_EAT_BETTER   0x10
+
+// Meal time tag bits (Data.json "mealTime" array)
+#define TIME_MORNING    0x01
+#define TIME_AFTERNOON  0x02
+#define TIME_EVENING    0x04
+
+// Budget tag bits (Data.json "budget" array)
+#define BUDGET_LOW       0x01
+#define BUDGET_MODERATE  0x02
+#define BUDGET_HIGH      0x04
+
+// ================= ARENA STRINGS =================
+
+// Copy a string into the arena (NULL if out of memory)
+char* arenaStrdup(Arena *arena, const char *s, size_t len) {
+    char *copy = (char*)arenaAlloc(arena, len + 1);
+    if (copy == NULL) return NULL;
+    memcpy(copy, s, len);
+    copy[len] = '\0';
+    return copy;
+}
+
+// ================= STREAMING TOKENIZER =================
+
+typedef enum {
+    JSON_START_OBJECT,
+    JSON_END_OBJECT,
+    JSON_START_ARRAY,
+    JSON_END_ARRAY,
+    JSON_KEY,
+    JSON_STRING,
+    JSON_NUMBER,
+    JSON_LITERAL   // true / false / null (text in str)
+} JsonEvent;
+
+// Event callback; return non-zero to stop parsing
+typedef int (*JsonCallback)(void *ctx, JsonEvent event, const char *str, size_t len, double number);
+
+// Parser states of the pushdown automaton
+enum { S_VALUE, S_VALUE_OR_END, S_KEY, S_KEY_OR_END, S_COLON, S_COMMA_OR_END, S_DONE };
+
+typedef struct {
+    FILE *fp;
+    char *buf;          // READ_CHUNK bytes
+    size_t pos;
+    size_t len;
+    char *token;        // MAX_TOKEN bytes, holds the current string
+    size_t tokenLen;
+    long long bytesRead;
+    int line;
+    int failed;
+    int depth;
+    char stack[MAX_NESTING];  // '{' or '['
+} JsonStream;
+
+void closeStream(JsonStream *s) {
+    if (s->fp != NULL) fclose(s->fp);
+    free(s->buf);
+    free(s->token);
+    s->fp = NULL;
+    s->buf = NULL;
+    s->token = NULL;
+}
+
+int openStream(JsonStream *s, const char *path) {
+    memset(s, 0, sizeof(JsonStream));
+    s->fp = fopen(path, "rb");
+    if (s->fp == NULL) {
+        printf("❌ Cannot open %s\n", path);
+        return -1;
+    }
+    s->buf = (char*)malloc(READ_CHUNK);
+    s->token = (char*)malloc(MAX_TOKEN);
+    if (s->buf == NULL || s->token == NULL) {
+        printf("❌ Out of memory opening %s\n", path);
+        closeStream(s);
+        return -1;
+    }
+    s->line = 1;
+    return 0;
+}
+
+void streamError(JsonStream *s, const char *message) {
+    if (!s->failed) printf("❌ JSON line %d: %s\n", s->line, message);
+    s->failed = 1;
+}
+
+// Next byte, refilling the chunk buffer as needed (-1 at end of file)
+static inline int nextByte(JsonStream *s) {
+    if (s->pos == s->len) {
+        s->len = fread(s->buf, 1, READ_CHUNK, s->fp);
+        s->pos = 0;
+        s->bytesRead += (long long)s->len;
+        if (s->len == 0) return -1;
+    }
+    return (unsigned char)s->buf[s->pos++];
+}
+
+static inline int peekByte(JsonStream *s) {
+    int c = nextByte(s);
+    if (c >= 0) s->pos--;
+    return c;
+}
+
+int nextNonSpace(JsonStream *s) {
+    int c;
+    do {
+        c = nextByte(s);
+        if (c == '\n') s->line++;
+    } while (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+    return c;
+}
+
+int appendToken(JsonStream *s, const char *data, size_t n) {
+    if (s->tokenLen + n >= MAX_TOKEN) {
+        streamError(s, "string longer than MAX_TOKEN");
+        return -1;
+    }
+    memcpy(s->token + s->tokenLen, data, n);
+    s->tokenLen += n;
+    return 0;
+}
+
+int hexDigit(int c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+int readUnicodeEscape(JsonStream *s, uint32_t *cp) {
+    *cp = 0;
+    for (int i = 0; i < 4; i++) {
+        int h = hexDigit(nextByte(s));
+        if (h < 0) {
+            streamError(s, "bad \\u escape");
+            return -1;
+        }
+        *cp = *cp * 16 + (uint32_t)h;
+    }
+    return 0;
+}
+
+int appendUtf8(JsonStream *s, uint32_t cp) {
+    char out[4];
+    size_t n;
+    if (cp < 0x80) { out[0] = (char)cp; n = 1; }
+    else if (cp < 0x800) { out[0] = (char)(0xC0 | (cp >> 6)); out[1] = (char)(0x80 | (cp & 0x3F)); n = 2; }
+    else if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12)); out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F)); n = 3;
+    } else {
+        out[0] = (char)(0xF0 | (cp >> 18)); out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+        out[2] = (char)(0x80 | ((cp >> 6) & 0x3F)); out[3] = (char)(0x80 | (cp & 0x3F)); n = 4;
+    }
+    return appendToken(s, out, n);
+}
+
+// Read a string body (opening quote already consumed) into s->token.
+// Plain runs are copied straight from the chunk buffer with memcpy.
+int readString(JsonStream *s) {
+    s->tokenLen = 0;
+    while (1) {
+        if (s->pos == s->len && peekByte(s) < 0) {
+            streamError(s, "unterminated string");
+            return -1;
+        }
+        size_t start = s->pos;
+        while (s->pos < s->len && s->buf[s->pos] != '"' && s->buf[s->pos] != '\\') s->pos++;
+        if (appendToken(s, s->buf + start, s->pos - start) != 0) return -1;
+        if (s->pos == s->len) continue;
+
+        char c = s->buf[s->pos++];
+        if (c == '"') break;
+
+        int e = nextByte(s);
+        uint32_t cp;
+        switch (e) {
+            case 'n': cp = '\n'; break;
+            case 't': cp = '\t'; break;
+            case 'r': cp = '\r'; break;
+            case 'b': cp = '\b'; break;
+            case 'f': cp = '\f'; break;
+            case 'u':
+                if (readUnicodeEscape(s, &cp) != 0) return -1;
+                if (cp >= 0xD800 && cp < 0xDC00 && peekByte(s) == '\\') {
+                    uint32_t low;
+                    nextByte(s);
+                    if (nextByte(s) != 'u' || readUnicodeEscape(s, &low) != 0) {
+                        streamError(s, "bad surrogate pair");
+                        return -1;
+                    }
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                }
+                break;
+            case '"': case '\\': case '/': cp = (uint32_t)e; break;
+            default:
+                streamError(s, "bad escape");
+                return -1;
+        }
+        if (appendUtf8(s, cp) != 0) return -1;
+    }
+    s->token[s->tokenLen] = '\0';
+    return 0;
+}
+
+// Read a number or literal whose first byte is first
+int readScalar(JsonStream *s, int first) {
+    s->tokenLen = 0;
+    s->token[s->tokenLen++] = (char)first;
+    int c;
+    while ((c = peekByte(s)) >= 0 && ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+                                      c == '.' || c == '-' || c == '+' || c == 'E')) {
+        if (s->tokenLen >= 63) {
+            streamError(s, "number too long");
+            return -1;
+        }
+        s->token[s->tokenLen++] = (char)nextByte(s);
+    }
+    s->token[s->tokenLen] = '\0';
+    return 0;
+}
+
+int afterValue(JsonStream *s) {
+    return s->depth == 0 ? S_DONE : S_COMMA_OR_END;
+}
+
+// Drive the callback over the whole file
+// Time Complexity: O(file size)
+// Space Complexity: O(READ_CHUNK + MAX_TOKEN + MAX_NESTING)
+int parseStream(JsonStream *s, JsonCallback callback, void *ctx) {
+    int state = S_VALUE;
+    int stopped = 0;
+
+    while (!s->failed && !stopped) {
+        int c = nextNonSpace(s);
+        if (c < 0) {
+            if (state != S_DONE) streamError(s, "unexpected end of file");
+            break;
+        }
+
+        switch (state) {
+            case S_DONE:
+                streamError(s, "trailing data after top-level value");
+                break;
+
+            case S_COLON:
+                if (c == ':') state = S_VALUE;
+                else streamError(s, "expected ':'");
+                break;
+
+            case S_KEY:
+            case S_KEY_OR_END:
+                if (c == '}' && state == S_KEY_OR_END) {
+                    s->depth--;
+                    stopped = callback(ctx, JSON_END_OBJECT, NULL, 0, 0);
+                    state = afterValue(s);
+                } else if (c == '"') {
+                    if (readString(s) != 0) break;
+                    stopped = callback(ctx, JSON_KEY, s->token, s->tokenLen, 0);
+                    state = S_COLON;
+                } else {
+                    streamError(s, "expected key");
+                }
+                break;
+
+            case S_COMMA_OR_END: {
+                char open = s->stack[s->depth - 1];
+                if (c == ',') {
+                    state = open == '{' ? S_KEY : S_VALUE;
+                } else if ((c == '}' && open == '{') || (c == ']' && open == '[')) {
+                    s->depth--;
+                    stopped = callback(ctx, c == '}' ? JSON_END_OBJECT : JSON_END_ARRAY, NULL, 0, 0);
+                    state = afterValue(s);
+                } else {
+                    streamError(s, "expected ',' or closing bracket");
+                }
+                break;
+            }
+
+            case S_VALUE:
+            case S_VALUE_OR_END:
+                if (c == ']' && state == S_VALUE_OR_END) {
+                    s->depth--;
+                    stopped = callback(ctx, JSON_END_ARRAY, NULL, 0, 0);
+                    state = afterValue(s);
+                } else if (c == '{' || c == '[') {
+                    if (s->depth >= MAX_NESTING) {
+                        streamError(s, "nesting too deep");
+                        break;
+                    }
+                    s->stack[s->depth++] = (char)c;
+                    stopped = callback(ctx, c == '{' ? JSON_START_OBJECT : JSON_START_ARRAY, NULL, 0, 0);
+                    state = c == '{' ? S_KEY_OR_END : S_VALUE_OR_END;
+                } else if (c == '"') {
+                    if (readString(s) != 0) break;
+                    stopped = callback(ctx, JSON_STRING, s->token, s->tokenLen, 0);
+                    state = afterValue(s);
+                } else if (c == '-' || (c >= '0' && c <= '9')) {
+                    if (readScalar(s, c) != 0) break;
+                    char *end;
+                    double value = strtod(s->token, &end);
+                    if (*end != '\0') streamError(s, "bad number");
+                    else stopped = callback(ctx, JSON_NUMBER, s->token, s->tokenLen, value);
+                    state = afterValue(s);
+                } else if (c == 't' || c == 'f' || c == 'n') {
+                    if (readScalar(s, c) != 0) break;
+                    if (strcmp(s->token, "true") != 0 && strcmp(s->token, "false") != 0 &&
+                        strcmp(s->token, "null") != 0) {
+                        streamError(s, "bad literal");
+                    } else {
+                        stopped = callback(ctx, JSON_LITERAL, s->token, s->tokenLen, 0);
+                    }
+                    state = afterValue(s);
+                } else {
+                    streamError(s, "unexpected character");
+                }
+                break;
+        }
+    }
+    return s->failed ? -1 : 0;
+}
+
+// ================= CATALOGUE RECORDS =================
+
+// Food record; every string points into the loader's arena
+typedef struct {
+    int id;
+    const char *name;
+    const char *hindiName;
+    const char *icon;
+    const char *category;
+    const char *dietType;
+    int calories;
+    float protein;
+    float carbs;
+    float fats;
+    int cost;
+    int cookTime;
+    uint8_t goals;       // GOAL_* bits
+    uint8_t mealTimes;   // TIME_* bits
+    uint8_t budgets;     // BUDGET_* bits
+    const char **steps;
+    int numSteps;
+} FoodRecord;
+
+typedef struct {
+    int id;
+    const char *name;
+    const char *icon;
+    int calories;
+} JunkRecord;
+
+// Batch consumers; records (and their strings) stay valid until the
+// callback returns when boundedMemory is set, otherwise until freeArena
+typedef struct {
+    int batchSize;
+    int boundedMemory;
+    void (*onFoods)(void *ctx, const FoodRecord *foods, int count);
+    void (*onJunkFoods)(void *ctx, const JunkRecord *junk, int count);
+    void *ctx;
+} LoaderOptions;
+
+enum { SECTION_NONE, SECTION_FOODS, SECTION_JUNK };
+
+typedef struct {
+    Arena *arena;
+    const LoaderOptions *options;
+    int depth;
+    int section;
+    char rootKey[32];
+    char fieldKey[32];
+    FoodRecord *foods;
+    JunkRecord *junk;
+    int count;
+    const char **stepScratch;   // steps of the food being read
+    int numSteps;
+    int stepCapacity;
+    long long totalFoods;
+    long long totalJunk;
+    long long totalSteps;
+    size_t peakArena;
+    int failed;
+} CatalogueLoader;
+
+uint8_t goalBit(const char *s) {
+    if (strcmp(s, "weight-loss") == 0) return GOAL_WEIGHT_LOSS;
+    if (strcmp(s, "muscle-gain") == 0) return GOAL_MUSCLE_GAIN;
+    if (strcmp(s, "maintain") == 0) return GOAL_MAINTAIN;
+    if (strcmp(s, "pcod") == 0) return GOAL_PCOD;
+    if (strcmp(s, "eat-better") == 0) return GOAL_EAT_BETTER;
+    return 0;
+}
+
+uint8_t mealTimeBit(const char *s) {
+    if (strcmp(s, "morning") == 0) return TIME_MORNING;
+    if (strcmp(s, "afternoon") == 0) return TIME_AFTERNOON;
+    if (strcmp(s, "evening") == 0) return TIME_EVENING;
+    return 0;
+}
+
+uint8_t budgetBit(const char *s) {
+    if (strcmp(s, "low") == 0) return BUDGET_LOW;
+    if (strcmp(s, "moderate") == 0) return BUDGET_MODERATE;
+    if (strcmp(s, "high") == 0) return BUDGET_HIGH;
+    return 0;
+}
+
+// Allocate the record array for the next batch
+int startBatch(CatalogueLoader *loader) {
+    int n = loader->options->batchSize;
+    loader->count = 0;
+    if (loader->section == SECTION_FOODS) {
+        loader->foods = (FoodRecord*)arenaAlloc(loader->arena, n * sizeof(FoodRecord));
+        return loader->foods == NULL ? -1 : 0;
+    }
+    loader->junk = (JunkRecord*)arenaAlloc(loader->arena, n * sizeof(JunkRecord));
+    return loader->junk == NULL ? -1 : 0;
+}
+
+// Hand the current batch to the consumer, then recycle the arena if bounded
+int flushBatch(CatalogueLoader *loader) {
+    const LoaderOptions *opt = loader->options;
+    if (loader->count > 0) {
+        if (loader->section == SECTION_FOODS && opt->onFoods != NULL) {
+            opt->onFoods(opt->ctx, loader->foods, loader->count);
+        } else if (loader->section == SECTION_JUNK && opt->onJunkFoods != NULL) {
+            opt->onJunkFoods(opt->ctx, loader->junk, loader->count);
+        }
+    }
+    if (loader->arena->stats.bytesReserved > loader->peakArena) loader->peakArena = loader->arena->stats.bytesReserved;
+    if (opt->boundedMemory) arenaReset(loader->arena);
+    return startBatch(loader);
+}
+
+// Copy the collected step pointers into the arena and close the record
+int finishFood(CatalogueLoader *loader) {
+    FoodRecord *food = &loader->foods[loader->count];
+    food->numSteps = loader->numSteps;
+    food->steps = (const char**)arenaAlloc(loader->arena, (loader->numSteps + 1) * sizeof(char*));
+    if (food->steps == NULL) return -1;
+    memcpy(food->steps, loader->stepScratch, loader->numSteps * sizeof(char*));
+    loader->totalSteps += loader->numSteps;
+    loader->totalFoods++;
+    loader->count++;
+    return 0;
+}
+
+void setFoodString(CatalogueLoader *loader, FoodRecord *food, const char *str, size_t len) {
+    const char *key = loader->fieldKey;
+    const char **field = NULL;
+    if (strcmp(key, "name") == 0) field = &food->name;
+    else if (strcmp(key, "hindiName") == 0) field = &food->hindiName;
+    else if (strcmp(key, "icon") == 0) field = &food->icon;
+    else if (strcmp(key, "category") == 0) field = &food->category;
+    else if (strcmp(key, "dietType") == 0) field = &food->dietType;
+    if (field != NULL) *field = arenaStrdup(loader->arena, str, len);
+}
+
+void setFoodNumber(CatalogueLoader *loader, FoodRecord *food, double value) {
+    const char *key = loader->fieldKey;
+    if (strcmp(key, "id") == 0) food->id = (int)value;
+    else if (strcmp(key, "calories") == 0) food->calories = (int)value;
+    else if (strcmp(key, "protein") == 0) food->protein = (float)value;
+    else if (strcmp(key, "carbs") == 0) food->carbs = (float)value;
+    else if (strcmp(key, "fats") == 0) food->fats = (float)value;
+    else if (strcmp(key, "cost") == 0) food->cost = (int)value;
+    else if (strcmp(key, "cookTime") == 0) food->cookTime = (int)value;
+}
+
+// Array element inside a food: goal/mealTime/budget tags or a recipe step
+int addFoodArrayItem(CatalogueLoader *loader, FoodRecord *food, const char *str, size_t len) {
+    const char *key = loader->fieldKey;
+    if (strcmp(key, "goal") == 0) food->goals |= goalBit(str);
+    else if (strcmp(key, "mealTime") == 0) food->mealTimes |= mealTimeBit(str);
+    else if (strcmp(key, "budget") == 0) food->budgets |= budgetBit(str);
+    else if (strcmp(key, "steps") == 0) {
+        if (loader->numSteps == loader->stepCapacity) {
+            int newCapacity = loader->stepCapacity == 0 ? 32 : loader->stepCapacity * 2;
+            const char **grown = (const char**)realloc(loader->stepScratch, newCapacity * sizeof(char*));
+            if (grown == NULL) return -1;
+            loader->stepScratch = grown;
+            loader->stepCapacity = newCapacity;
+        }
+        loader->stepScratch[loader->numSteps++] = arenaStrdup(loader->arena, str, len);
+    }
+    return 0;
+}
+
+// SAX callback mapping the Data.json schema onto records:
+// depth 1 = root object, 2 = foods/junkFoods array, 3 = record, 4 = tag/steps array
+int onCatalogueEvent(void *ctx, JsonEvent event, const char *str, size_t len, double number) {
+    CatalogueLoader *loader = (CatalogueLoader*)ctx;
+    int inRecord = loader->section != SECTION_NONE && loader->depth >= 3;
+
+    switch (event) {
+        case JSON_START_OBJECT:
+        case JSON_START_ARRAY:
+            loader->depth++;
+            if (event == JSON_START_ARRAY && loader->depth == 2) {
+                if (strcmp(loader->rootKey, "foods") == 0) loader->section = SECTION_FOODS;
+                else if (strcmp(loader->rootKey, "junkFoods") == 0) loader->section = SECTION_JUNK;
+                if (loader->section != SECTION_NONE && startBatch(loader) != 0) return 1;
+            }
+            if (event == JSON_START_OBJECT && loader->depth == 3 && loader->section != SECTION_NONE) {
+                if (loader->section == SECTION_FOODS) {
+                    memset(&loader->foods[loader->count], 0, sizeof(FoodRecord));
+                    loader->foods[loader->count].name = "";
+                    loader->foods[loader->count].hindiName = "";
+                    loader->foods[loader->count].icon = "";
+                    loader->foods[loader->count].category = "";
+                    loader->foods[loader->count].dietType = "";
+                    loader->numSteps = 0;
+                } else {
+                    JunkRecord *junk = &loader->junk[loader->count];
+                    memset(junk, 0, sizeof(JunkRecord));
+                    junk->name = "";
+                    junk->icon = "";
+                }
+            }
+            return 0;
+
+        case JSON_END_OBJECT:
+        case JSON_END_ARRAY:
+            if (inRecord && loader->depth == 3 && event == JSON_END_OBJECT) {
+                if (loader->section == SECTION_FOODS) {
+                    if (finishFood(loader) != 0) return 1;
+                } else {
+                    loader->totalJunk++;
+                    loader->count++;
+                }
+                if (loader->count == loader->options->batchSize && flushBatch(loader) != 0) return 1;
+            }
+            if (loader->depth == 2 && event == JSON_END_ARRAY && loader->section != SECTION_NONE) {
+                if (flushBatch(loader) != 0) return 1;
+                loader->section = SECTION_NONE;
+            }
+            loader->depth--;
+            return 0;
+
+        case JSON_KEY:
+            if (loader->depth == 1) snprintf(loader->rootKey, sizeof(loader->rootKey), "%s", str);
+            else if (loader->depth == 3) snprintf(loader->fieldKey, sizeof(loader->fieldKey), "%s", str);
+            return 0;
+
+        case JSON_STRING:
+            if (!inRecord) return 0;
+            if (loader->section == SECTION_FOODS) {
+                FoodRecord *food = &loader->foods[loader->count];
+                if (loader->depth == 3) setFoodString(loader, food, str, len);
+                else if (loader->depth == 4 && addFoodArrayItem(loader, food, str, len) != 0) return 1;
+            } else if (loader->depth == 3) {
+                JunkRecord *junk = &loader->junk[loader->count];
+                if (strcmp(loader->fieldKey, "name") == 0) junk->name = arenaStrdup(loader->arena, str, len);
+                else if (strcmp(loader->fieldKey, "icon") == 0) junk->icon = arenaStrdup(loader->arena, str, len);
+            }
+            return 0;
+
+        case JSON_NUMBER:
+            if (!inRecord || loader->depth != 3) return 0;
+            if (loader->section == SECTION_FOODS) {
+                setFoodNumber(loader, &loader->foods[loader->count], number);
+            } else {
+                JunkRecord *junk = &loader->junk[loader->count];
+                if (strcmp(loader->fieldKey, "id") == 0) junk->id = (int)number;
+                else if (strcmp(loader->fieldKey, "calories") == 0) junk->calories = (int)number;
+            }
+            return 0;
+
+        case JSON_LITERAL:
+            return 0;
+    }
+    return 0;
+}
+
+// Stream a Data.json-shaped catalogue through the batch callbacks
+// Returns 0 on success; stats (foods/steps/peak arena) are printed by callers
+// Time Complexity: O(file size)
+// Space Complexity: O(chunk + longest string + one batch) when boundedMemory
+int loadCatalogue(const char *path, Arena *arena, const LoaderOptions *options,
+                  CatalogueLoader *stats) {
+    JsonStream stream;
+    if (openStream(&stream, path) != 0) return -1;
+
+    memset(stats, 0, sizeof(CatalogueLoader));
+    stats->arena = arena;
+    stats->options = options;
+
+    int result = parseStream(&stream, onCatalogueEvent, stats);
+    if (result == 0 && stats->depth != 0) result = -1;  // a callback stopped early (out of memory)
+    if (arena->stats.bytesReserved > stats->peakArena) stats->peakArena = arena->stats.bytesReserved;
+
+    free(stats->stepScratch);
+    stats->stepScratch = NULL;
+    closeStream(&stream);
+    return result;
+}
+
+// ================= DEMO CONSUMERS =================
+
+// Meal record as used by priority_queue.c, filled from the stream
+typedef struct {
+    char name[50];
+    char hindiName[50];
+    int calories;
+    float protein;
+    float carbs;
+    float fats;
+    int cost;
+    int score;
+} Meal;
+
+typedef struct {
+    Meal meals[64];
+    int numMeals;
+    int printedRecipes;
+} DemoContext;
+
+void collectFoods(void *ctx, const FoodRecord *foods, int count) {
+    DemoContext *demo = (DemoContext*)ctx;
+    for (int i = 0; i < count; i++) {
+        const FoodRecord *f = &foods[i];
+        if (demo->numMeals < 64) {
+            Meal *m = &demo->meals[demo->numMeals++];
+            snprintf(m->name, sizeof(m->name), "%s", f->name);
+            snprintf(m->hindiName, sizeof(m->hindiName), "%s", f->hindiName);
+            m->calories = f->calories;
+            m->protein = f->protein;
+            m->carbs = f->carbs;
+            m->fats = f->fats;
+            m->cost = f->cost;
+            m->score = 0;
+        }
+        if (demo->printedRecipes < 2) {
+            demo->printedRecipes++;
+            printf("%s %s (%s) - %d kcal, %s, %d steps\n", f->icon, f->name, f->hindiName,
+                   f->calories, f->dietType, f->numSteps);
+            for (int s = 0; s < f->numSteps; s++) printf("   %d. %s\n", s + 1, f->steps[s]);
+        }
+    }
+}
+
+void printJunkFoods(void *ctx, const JunkRecord *junk, int count) {
+    (void)ctx;
+    printf("\n--- JUNK FOODS (batch of %d) ---\n", count);
+    for (int i = 0; i < count; i++) {
+        printf("  %s %-20s %d kcal\n", junk[i].icon, junk[i].name, junk[i].calories);
+    }
+}
+
+// Counts only; used by the benchmark
+void countFoods(void *ctx, const FoodRecord *foods, int count) {
+    long long *calories = (long long*)ctx;
+    for (int i = 0; i < count; i++) *calories += foods[i].calories;
+}
+
+// Write a synthetic catalogue of roughly targetBytes by repeating food objects
+long long writeSyntheticCatalogue(const char *path, long long targetBytes) {
+    static const char *names[] = { "Moong Dal Cheela", "Paneer Bhurji", "Chicken Curry", "Poha" };
+    static const char *diets[] = { "veg", "veg", "non-veg", "veg" };
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL) return -1;
+
+    long long written = fprintf(fp, "{\n  \"foods\": [\n");
+    long long id = 0;
+    while (written < targetBytes) {
+        int k = (int)(id % 4);
+        written += fprintf(fp,
+            "%s    {\n      \"id\": %lld,\n      \"name\": \"%s %lld\",\n"
+            "      \"hindiName\": \"\\u092a\\u0928\\u0940\\u0930\",\n      \"icon\": \"🍛\",\n"
+            "      \"calories\": %lld,\n      \"protein\": %.1f,\n      \"carbs\": 25,\n      \"fats\": 4,\n"
+            "      \"cost\": 20,\n      \"cookTime\": 15,\n      \"category\": \"lunch\",\n"
+            "      \"dietType\": \"%s\",\n      \"goal\": [\"weight-loss\", \"maintain\"],\n"
+            "      \"mealTime\": [\"afternoon\"],\n      \"budget\": [\"low\"],\n"
+            "      \"steps\": [\n        \"Soak for 2 hours and grind to a smooth paste\",\n"
+            "        \"Add chopped onions, green chili, coriander\",\n"
+            "        \"Cook both sides with minimal oil\",\n        \"Serve hot with green chutney\"\n      ]\n    }",
+            id == 0 ? "" : ",\n", id, names[k], id, 100 + id % 400, 5.0 + (double)(id % 30), diets[k]);
+        id++;
+    }
+    written += fprintf(fp, "\n  ],\n  \"junkFoods\": [\n    { \"id\": 101, \"name\": \"Pizza\", "
+                           "\"icon\": \"🍕\", \"calories\": 700 }\n  ]\n}\n");
+    fclose(fp);
+    return written;
+}
+
+void benchmarkLoader(const char *path, long long targetBytes) {
+    long long bytes = writeSyntheticCatalogue(path, targetBytes);
+    if (bytes < 0) {
+        printf("❌ Cannot write %s\n", path);
+        return;
+    }
+
+    Arena arena;
+    initArena(&arena, ARENA_BLOCK);
+    long long totalCalories = 0;
+    LoaderOptions options = { 1024, 1, countFoods, NULL, &totalCalories };
+    CatalogueLoader stats;
+
+    clock_t start = clock();
+    int result = loadCatalogue(path, &arena, &options, &stats);
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    printf("=== BENCHMARK: %.1f MB synthetic catalogue ===\n", bytes / 1e6);
+    if (result != 0) printf("❌ Load failed\n");
+    printf("Foods: %lld | Steps: %lld | Time: %.2f s | Throughput: %.1f MB/s\n",
+           stats.totalFoods, stats.totalSteps, seconds, bytes / 1e6 / seconds);
+    printf("Peak arena: %.2f MB | Max RSS: %.2f MB (file is %.1f MB)\n\n",
+           stats.peakArena / 1e6, usage.ru_maxrss / 1024.0, bytes / 1e6);
+
+    freeArena(&arena);
+    remove(path);
+}
+
+// Usage: json_loader [Data.json] [benchmark MB]
+int main(int argc, char **argv) {
+    const char *path = argc > 1 ? argv[1] : "Data.json";
+    long long benchMb = argc > 2 ? atoll(argv[2]) : 64;
+
+    printf("\n=== NutriPlan Streaming Catalogue Loader (SAX) ===\n\n");
+
+    Arena arena;
+    initArena(&arena, ARENA_BLOCK);
+    DemoContext demo;
+    memset(&demo, 0, sizeof(demo));
+    LoaderOptions options = { 256, 0, collectFoods, printJunkFoods, &demo };
+    CatalogueLoader stats;
+
+    printf("--- FOODS (first recipes) ---\n");
+    if (loadCatalogue(path, &arena, &options, &stats) != 0) {
+        freeArena(&arena);
+        return 1;
+    }
+    printf("\nLoaded %lld foods, %lld junk foods, %lld recipe steps using %.1f KB of arena\n",
+           stats.totalFoods, stats.totalJunk, stats.totalSteps, stats.peakArena / 1024.0);
+    printf("Meal records ready for ranking: %d (first: %s, %d kcal)\n\n", demo.numMeals,
+           demo.numMeals > 0 ? demo.meals[0].name : "-", demo.numMeals > 0 ? demo.meals[0].calories : 0);
+    freeArena(&arena);
+
+    if (benchMb > 0) benchmarkLoader("nutriplan_bench_catalogue.json", benchMb * 1000 * 1000);
+
+    return 0;
+}
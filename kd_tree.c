@@ -0,0 +1,448 @@
+// K-D Tree for Multi-Attribute Food Filtering
+// NutriPlan - Data Structures Project
+// Answers compound filters (calorie window, minimum protein, budget cap,
+// diet type, goal/mealTime/budget tags) without scanning every food
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <float.h>
+#include <time.h>
+#include "string_pool.h"   // DietType, DIET_MASK_*, parseDietType
+
+#define KD_DIMS 3        // calories, protein, cost
+#define KD_LEAF_SIZE 8   // foods per leaf before splitting stops
+#define KD_MAX_DEPTH 64
+
+// Goal tag bits (Data.json "goal" array, not the scoring Goal enum)
+#define GOAL_MASK_WEIGHT_LOSS  0x01
+#define GOAL_MASK_MUSCLE_GAIN  0x02
+#define GOAL_MASK_MAINTAIN     0x04
+#define GOAL_MASK_PCOD         0x08
+#define GOAL_MASK_EAT_BETTER   0x10
+
+// Meal time tag bits (Data.json "mealTime" array)
+#define TIME_MORNING    0x01
+#define TIME_AFTERNOON  0x02
+#define TIME_EVENING    0x04
+
+// Budget tag bits (Data.json "budget" array)
+#define BUDGET_LOW       0x01
+#define BUDGET_MODERATE  0x02
+#define BUDGET_HIGH      0x04
+
+// Food point: the numeric keys plus tag bitmasks, no text
+typedef struct {
+    float key[KD_DIMS];  // calories, protein, cost
+    uint32_t rowId;
+    uint8_t diet;
+    uint8_t goals;
+    uint8_t mealTimes;
+    uint8_t budgets;
+} FoodPoint;
+
+// Subtree summary used for pruning: bounding box plus OR of all tags
+typedef struct {
+    float min[KD_DIMS];
+    float max[KD_DIMS];
+    int lo;        // points[lo..hi) belong to this subtree
+    int hi;
+    int left;      // child node ids, -1 for a leaf
+    int right;
+    uint8_t diet;
+    uint8_t goals;
+    uint8_t mealTimes;
+    uint8_t budgets;
+} KdNode;
+
+typedef struct {
+    FoodPoint *points;  // reordered so every subtree is a contiguous range
+    KdNode *nodes;
+    int numPoints;
+    int numNodes;
+} KdIndex;
+
+// Compound filter; a zero mask means "any"
+typedef struct {
+    int minCalories;
+    int maxCalories;
+    float minProtein;
+    int maxCost;
+    uint8_t dietMask;
+    uint8_t goalMask;
+    uint8_t mealTimeMask;
+    uint8_t budgetMask;
+} FoodQuery;
+
+// Text columns live outside the index; row id = position
+typedef struct {
+    char name[50];
+    char dietType[20];
+} FoodLabel;
+
+// ================= BUILD =================
+
+// Partition points[lo..hi) so points[k] holds the k-th smallest value on dim
+// Time Complexity: O(n) average (quickselect)
+void selectKth(FoodPoint *points, int lo, int hi, int k, int dim) {
+    while (hi - lo > 1) {
+        float pivot = points[lo + (hi - lo) / 2].key[dim];
+        int i = lo, j = hi - 1;
+        while (i <= j) {
+            while (points[i].key[dim] < pivot) i++;
+            while (points[j].key[dim] > pivot) j--;
+            if (i <= j) {
+                FoodPoint tmp = points[i];
+                points[i] = points[j];
+                points[j] = tmp;
+                i++;
+                j--;
+            }
+        }
+        if (k <= j) hi = j + 1;
+        else if (k >= i) lo = i;
+        else return;
+    }
+}
+
+// Recursively build the subtree over points[lo..hi), returns its node id
+// Splits on the widest dimension at the median
+// Time Complexity: O(n log n)
+// Space Complexity: O(log n) for recursion
+int buildNode(KdIndex *index, int lo, int hi) {
+    int id = index->numNodes++;
+    KdNode *node = &index->nodes[id];
+    node->lo = lo;
+    node->hi = hi;
+    node->left = -1;
+    node->right = -1;
+    node->diet = node->goals = node->mealTimes = node->budgets = 0;
+
+    for (int d = 0; d < KD_DIMS; d++) {
+        node->min[d] = FLT_MAX;
+        node->max[d] = -FLT_MAX;
+    }
+    for (int i = lo; i < hi; i++) {
+        FoodPoint *p = &index->points[i];
+        for (int d = 0; d < KD_DIMS; d++) {
+            if (p->key[d] < node->min[d]) node->min[d] = p->key[d];
+            if (p->key[d] > node->max[d]) node->max[d] = p->key[d];
+        }
+        node->diet |= p->diet;
+        node->goals |= p->goals;
+        node->mealTimes |= p->mealTimes;
+        node->budgets |= p->budgets;
+    }
+
+    if (hi - lo <= KD_LEAF_SIZE) return id;
+
+    int dim = 0;
+    for (int d = 1; d < KD_DIMS; d++) {
+        if (node->max[d] - node->min[d] > node->max[dim] - node->min[dim]) dim = d;
+    }
+    int mid = lo + (hi - lo) / 2;
+    selectKth(index->points, lo, hi, mid, dim);
+
+    node->left = buildNode(index, lo, mid);
+    node->right = buildNode(index, mid, hi);
+    return id;
+}
+
+void freeKdIndex(KdIndex *index) {
+    free(index->points);
+    free(index->nodes);
+    index->points = NULL;
+    index->nodes = NULL;
+    index->numPoints = index->numNodes = 0;
+}
+
+// Build the index over a copy of the given points
+// Returns 0 on success, -1 if out of memory (index left empty)
+// Time Complexity: O(n log n)
+// Space Complexity: O(n)
+int buildKdIndex(KdIndex *index, const FoodPoint *points, int n) {
+    index->numPoints = n;
+    index->numNodes = 0;
+    index->points = (FoodPoint*)malloc((n > 0 ? n : 1) * sizeof(FoodPoint));
+    index->nodes = (KdNode*)malloc((2 * n + 1) * sizeof(KdNode));  // binary tree bound
+    if (index->points == NULL || index->nodes == NULL) {
+        printf("❌ Out of memory building k-d tree\n");
+        freeKdIndex(index);
+        return -1;
+    }
+    memcpy(index->points, points, n * sizeof(FoodPoint));
+    if (n > 0) buildNode(index, 0, n);
+    return 0;
+}
+
+// ================= QUERY =================
+
+// Tag filters: each requested mask must share a bit with the food's tags
+int tagsMatch(uint8_t diet, uint8_t goals, uint8_t mealTimes, uint8_t budgets,
+              const FoodQuery *q) {
+    return (q->dietMask == 0 || (diet & q->dietMask)) &&
+           (q->goalMask == 0 || (goals & q->goalMask)) &&
+           (q->mealTimeMask == 0 || (mealTimes & q->mealTimeMask)) &&
+           (q->budgetMask == 0 || (budgets & q->budgetMask));
+}
+
+// Write row ids of every food satisfying the query into outRows
+// Returns the total number of matches, writing at most maxOut of them.
+// Subtrees are skipped when their bounding box misses the numeric window or
+// none of their foods carries a requested tag; fully covered subtrees only
+// check tags per food.
+// Time Complexity: O(n^(2/3) + k) for a box query on 3 dimensions
+// Space Complexity: O(log n) explicit stack
+int kdQuery(const KdIndex *index, const FoodQuery *q, uint32_t *outRows, int maxOut) {
+    if (index->numPoints == 0) return 0;
+
+    float qMin[KD_DIMS] = { (float)q->minCalories, q->minProtein, -FLT_MAX };
+    float qMax[KD_DIMS] = { (float)q->maxCalories, FLT_MAX, (float)q->maxCost };
+
+    int stack[KD_MAX_DEPTH];
+    int top = 0;
+    int found = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const KdNode *node = &index->nodes[stack[--top]];
+
+        int inside = 1;
+        int disjoint = 0;
+        for (int d = 0; d < KD_DIMS; d++) {
+            if (node->max[d] < qMin[d] || node->min[d] > qMax[d]) disjoint = 1;
+            if (node->min[d] < qMin[d] || node->max[d] > qMax[d]) inside = 0;
+        }
+        if (disjoint) continue;
+        if (!tagsMatch(node->diet, node->goals, node->mealTimes, node->budgets, q)) continue;
+
+        if (inside || node->left < 0) {
+            for (int i = node->lo; i < node->hi; i++) {
+                const FoodPoint *p = &index->points[i];
+                if (!inside) {
+                    int ok = 1;
+                    for (int d = 0; d < KD_DIMS; d++) {
+                        if (p->key[d] < qMin[d] || p->key[d] > qMax[d]) ok = 0;
+                    }
+                    if (!ok) continue;
+                }
+                if (!tagsMatch(p->diet, p->goals, p->mealTimes, p->budgets, q)) continue;
+                if (found < maxOut) outRows[found] = p->rowId;
+                found++;
+            }
+            continue;
+        }
+
+        stack[top++] = node->right;
+        stack[top++] = node->left;
+    }
+
+    return found;
+}
+
+// ================= DEMO CATALOGUE =================
+
+typedef struct {
+    FoodPoint *points;
+    FoodLabel *labels;
+    int count;
+    int capacity;
+} FoodCatalogue;
+
+void initCatalogue(FoodCatalogue *catalogue) {
+    catalogue->points = NULL;
+    catalogue->labels = NULL;
+    catalogue->count = 0;
+    catalogue->capacity = 0;
+}
+
+// Add food with its Data.json tags, returns row id
+// Returns -1 if out of memory or the diet type is unknown
+// Time Complexity: O(1) amortized
+int addFood(FoodCatalogue *catalogue, char *name, int calories, float protein, int cost,
+            char *dietType, uint8_t goals, uint8_t mealTimes, uint8_t budgets) {
+    int diet = parseDietType(dietType);
+    if (diet == DIET_UNKNOWN || diet == DIET_ANY) {
+        printf("❌ Unknown diet type '%s'!\n", dietType);
+        return -1;
+    }
+    if (catalogue->count == catalogue->capacity) {
+        int newCapacity = catalogue->capacity == 0 ? 64 : catalogue->capacity * 2;
+        FoodPoint *points = (FoodPoint*)realloc(catalogue->points, newCapacity * sizeof(FoodPoint));
+        if (points == NULL) return -1;
+        catalogue->points = points;
+        FoodLabel *labels = (FoodLabel*)realloc(catalogue->labels, newCapacity * sizeof(FoodLabel));
+        if (labels == NULL) return -1;
+        catalogue->labels = labels;
+        catalogue->capacity = newCapacity;
+    }
+
+    int row = catalogue->count++;
+    FoodPoint *p = &catalogue->points[row];
+    p->key[0] = (float)calories;
+    p->key[1] = protein;
+    p->key[2] = (float)cost;
+    p->rowId = (uint32_t)row;
+    p->diet = (uint8_t)(1u << diet);
+    p->goals = goals;
+    p->mealTimes = mealTimes;
+    p->budgets = budgets;
+    snprintf(catalogue->labels[row].name, sizeof(catalogue->labels[row].name), "%s", name);
+    snprintf(catalogue->labels[row].dietType, sizeof(catalogue->labels[row].dietType), "%s", dietType);
+    return row;
+}
+
+void freeCatalogue(FoodCatalogue *catalogue) {
+    free(catalogue->points);
+    free(catalogue->labels);
+    initCatalogue(catalogue);
+}
+
+// Run a query and print the matching foods
+void printQuery(const KdIndex *index, const FoodCatalogue *catalogue,
+                const char *title, const FoodQuery *q) {
+    uint32_t rows[64];
+    int found = kdQuery(index, q, rows, 64);
+
+    printf("=== %s ===\n", title);
+    for (int i = 0; i < found && i < 64; i++) {
+        const FoodPoint *p = &catalogue->points[rows[i]];
+        printf("  %-25s %4.0f kcal | P:%.1fg | Rs.%.0f | %s\n",
+               catalogue->labels[rows[i]].name, p->key[0], p->key[1], p->key[2],
+               catalogue->labels[rows[i]].dietType);
+    }
+    if (found == 0) printf("  No foods found\n");
+    printf("\n");
+}
+
+// ================= BENCHMARK: FULL SCAN vs K-D TREE =================
+
+// What callers do today: visit every food and strcmp the diet type
+int scanQuery(const FoodCatalogue *catalogue, const FoodQuery *q, const char *dietType,
+              uint32_t *outRows, int maxOut) {
+    int found = 0;
+    for (int i = 0; i < catalogue->count; i++) {
+        const FoodPoint *p = &catalogue->points[i];
+        if (p->key[0] < q->minCalories || p->key[0] > q->maxCalories) continue;
+        if (p->key[1] < q->minProtein || p->key[2] > q->maxCost) continue;
+        if (strcmp(catalogue->labels[i].dietType, dietType) != 0) continue;
+        if (!tagsMatch(p->diet, p->goals, p->mealTimes, p->budgets, q)) continue;
+        if (found < maxOut) outRows[found] = (uint32_t)i;
+        found++;
+    }
+    return found;
+}
+
+double elapsedMs(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+void benchmarkQueries(int n, int queries) {
+    static char *diets[] = { "veg", "non-veg", "egg" };
+    FoodCatalogue catalogue;
+    initCatalogue(&catalogue);
+    srand(11);
+    char name[50];
+    for (int i = 0; i < n; i++) {
+        sprintf(name, "Food %d", i);
+        addFood(&catalogue, name, 50 + rand() % 950, (float)(rand() % 400) / 10.0f,
+                10 + rand() % 190, diets[rand() % 3], (uint8_t)(1 + rand() % 31),
+                (uint8_t)(1 + rand() % 7), (uint8_t)(1 + rand() % 7));
+    }
+
+    clock_t start = clock();
+    KdIndex index;
+    if (buildKdIndex(&index, catalogue.points, catalogue.count) != 0) {
+        freeCatalogue(&catalogue);
+        return;
+    }
+    double buildMs = elapsedMs(start);
+
+    FoodQuery *qs = (FoodQuery*)malloc(queries * sizeof(FoodQuery));
+    uint8_t dietBits[] = { DIET_MASK_VEG, DIET_MASK_NON_VEG, DIET_MASK_EGG };
+    for (int i = 0; i < queries; i++) {
+        int lo = 50 + rand() % 900;
+        qs[i].minCalories = lo;
+        qs[i].maxCalories = lo + 50;
+        qs[i].minProtein = (float)(rand() % 30);
+        qs[i].maxCost = 20 + rand() % 60;
+        qs[i].dietMask = dietBits[i % 3];
+        qs[i].goalMask = GOAL_MASK_WEIGHT_LOSS;
+        qs[i].mealTimeMask = 0;
+        qs[i].budgetMask = 0;
+    }
+
+    uint32_t *rows = (uint32_t*)malloc(n * sizeof(uint32_t));
+    long scanTotal = 0, kdTotal = 0;
+
+    start = clock();
+    for (int i = 0; i < queries; i++) {
+        scanTotal += scanQuery(&catalogue, &qs[i], diets[i % 3], rows, n);
+    }
+    double scanMs = elapsedMs(start);
+
+    start = clock();
+    for (int i = 0; i < queries; i++) kdTotal += kdQuery(&index, &qs[i], rows, n);
+    double kdMs = elapsedMs(start);
+
+    printf("=== BENCHMARK: %d foods, %d compound queries ===\n", n, queries);
+    printf("K-D tree build: %.1f ms (%d nodes)\n", buildMs, index.numNodes);
+    printf("Full scan : %8.1f ms | %8.3f ms/query\n", scanMs, scanMs / queries);
+    printf("K-D tree  : %8.1f ms | %8.3f ms/query\n", kdMs, kdMs / queries);
+    printf("Average matches per query: %.1f\n", (double)kdTotal / queries);
+    if (scanTotal != kdTotal) printf("❌ Result mismatch: %ld vs %ld\n", scanTotal, kdTotal);
+    printf("\n");
+
+    free(rows);
+    free(qs);
+    freeKdIndex(&index);
+    freeCatalogue(&catalogue);
+}
+
+// Main function demonstrating multi-attribute queries
+int main() {
+    FoodCatalogue catalogue;
+    initCatalogue(&catalogue);
+
+    printf("=== NutriPlan Multi-Attribute Food Filter (K-D Tree) ===\n\n");
+
+    addFood(&catalogue, "Moong Dal Cheela", 180, 12.0, 20, "veg", GOAL_MASK_WEIGHT_LOSS | GOAL_MASK_MAINTAIN, TIME_MORNING, BUDGET_LOW);
+    addFood(&catalogue, "Oats Upma", 210, 8.0, 25, "veg", GOAL_MASK_WEIGHT_LOSS | GOAL_MASK_MAINTAIN, TIME_MORNING, BUDGET_LOW);
+    addFood(&catalogue, "Paneer Paratha", 320, 15.0, 50, "veg", GOAL_MASK_MAINTAIN | GOAL_MASK_MUSCLE_GAIN, TIME_MORNING, BUDGET_MODERATE);
+    addFood(&catalogue, "Egg Bhurji", 220, 18.0, 30, "egg", GOAL_MASK_WEIGHT_LOSS | GOAL_MASK_MUSCLE_GAIN, TIME_MORNING, BUDGET_LOW);
+    addFood(&catalogue, "Omelette", 200, 14.0, 20, "egg", GOAL_MASK_WEIGHT_LOSS | GOAL_MASK_MUSCLE_GAIN, TIME_MORNING, BUDGET_LOW);
+    addFood(&catalogue, "Dal Tadka with Roti", 320, 14.0, 30, "veg", GOAL_MASK_WEIGHT_LOSS | GOAL_MASK_MAINTAIN, TIME_AFTERNOON, BUDGET_LOW);
+    addFood(&catalogue, "Rajma Chawal", 380, 16.0, 35, "veg", GOAL_MASK_MAINTAIN | GOAL_MASK_MUSCLE_GAIN, TIME_AFTERNOON, BUDGET_LOW);
+    addFood(&catalogue, "Paneer Bhurji with Roti", 265, 18.5, 65, "veg", GOAL_MASK_WEIGHT_LOSS | GOAL_MASK_MUSCLE_GAIN, TIME_AFTERNOON, BUDGET_LOW);
+    addFood(&catalogue, "Palak Paneer", 300, 16.0, 70, "veg", GOAL_MASK_MAINTAIN | GOAL_MASK_PCOD, TIME_AFTERNOON, BUDGET_MODERATE);
+    addFood(&catalogue, "Chicken Curry with Roti", 380, 32.0, 80, "non-veg", GOAL_MASK_MUSCLE_GAIN | GOAL_MASK_MAINTAIN, TIME_AFTERNOON, BUDGET_LOW);
+    addFood(&catalogue, "Fish Curry", 320, 28.0, 90, "non-veg", GOAL_MASK_WEIGHT_LOSS | GOAL_MASK_MUSCLE_GAIN, TIME_AFTERNOON, BUDGET_LOW);
+    addFood(&catalogue, "Sprouts Salad", 150, 10.0, 20, "veg", GOAL_MASK_WEIGHT_LOSS | GOAL_MASK_PCOD, TIME_EVENING, BUDGET_LOW);
+    addFood(&catalogue, "Roasted Makhana", 160, 6.0, 35, "veg", GOAL_MASK_WEIGHT_LOSS | GOAL_MASK_MAINTAIN, TIME_EVENING, BUDGET_MODERATE);
+    addFood(&catalogue, "Chicken Salad", 250, 30.0, 70, "non-veg", GOAL_MASK_WEIGHT_LOSS | GOAL_MASK_MUSCLE_GAIN, TIME_EVENING, BUDGET_LOW);
+    addFood(&catalogue, "Grilled Chicken", 280, 35.0, 90, "non-veg", GOAL_MASK_WEIGHT_LOSS | GOAL_MASK_MUSCLE_GAIN, TIME_EVENING, BUDGET_LOW);
+
+    KdIndex index;
+    if (buildKdIndex(&index, catalogue.points, catalogue.count) != 0) {
+        freeCatalogue(&catalogue);
+        return 1;
+    }
+    printf("Indexed %d foods in %d k-d tree nodes\n\n", index.numPoints, index.numNodes);
+
+    FoodQuery weightLoss = { 150, 300, 10.0, 40, DIET_MASK_VEG, GOAL_MASK_WEIGHT_LOSS, 0, 0 };
+    printQuery(&index, &catalogue, "Veg weight loss: 150-300 kcal, >=10g protein, <=Rs.40", &weightLoss);
+
+    FoodQuery muscleGain = { 250, 450, 25.0, 100, DIET_MASK_NON_VEG | DIET_MASK_EGG, GOAL_MASK_MUSCLE_GAIN, 0, 0 };
+    printQuery(&index, &catalogue, "Non-veg/egg muscle gain: 250-450 kcal, >=25g protein", &muscleGain);
+
+    FoodQuery eveningSnack = { 0, 300, 0.0, 50, DIET_MASK_VEG, 0, TIME_EVENING, BUDGET_LOW };
+    printQuery(&index, &catalogue, "Low-budget veg evening snacks under 300 kcal", &eveningSnack);
+
+    freeKdIndex(&index);
+    freeCatalogue(&catalogue);
+
+    benchmarkQueries(1000000, 200);
+
+    return 0;
+}
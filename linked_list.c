@@ -1,114 +1,229 @@
-// Linked List for Recipe Step Management
+// Recipe Step Management (Gap Buffer)
 // NutriPlan - Data Structures Project
-// Dynamically manages cooking instructions with easy insertion/deletion
+// Dynamically manages cooking instructions with easy insertion/deletion.
+// Steps live in one array with a movable gap: appends and edits near the
+// last edit are O(1), any step is reachable by index in O(1), and there
+// is no per-step allocation. (Originally a singly linked list; the list
+// is kept below only as the benchmark baseline.)
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <ctype.h>
+#include "string_pool.h"
+#include "arena.h"
 
-// Recipe step node
+// Step text, interned once (repeated steps like "1 min" are shared)
+StringPool stepText;
+
+// Recipe step
 typedef struct StepNode {
     int stepNumber;
-    char instruction[200];
-    char timeEstimate[20];
-    struct StepNode *next;
+    StringId instruction;
+    StringId timeEstimate;  // as written, for display
+    int seconds;            // timeEstimate parsed once at insert
 } StepNode;
 
-// Create new step node
+// Steps [0, gapStart) and [gapEnd, capacity) of the buffer, in order
+typedef struct {
+    StepNode *steps;
+    int capacity;
+    int gapStart;
+    int gapEnd;
+    long totalSeconds;      // sum of steps[].seconds, kept by insert/delete
+} Recipe;
+
+#define INITIAL_STEPS 16
+
+// Initialize empty recipe
 // Time Complexity: O(1)
-// Space Complexity: O(1)
-StepNode* createStep(int number, char *instruction, char *time) {
-    StepNode newStep = (StepNode)malloc(sizeof(StepNode));
-    newStep->stepNumber = number;
-    strcpy(newStep->instruction, instruction);
-    strcpy(newStep->timeEstimate, time);
-    newStep->next = NULL;
-    return newStep;
+void initRecipe(Recipe *recipe) {
+    recipe->steps = NULL;
+    recipe->capacity = 0;
+    recipe->gapStart = 0;
+    recipe->gapEnd = 0;
+    recipe->totalSeconds = 0;
 }
 
-// Insert step at beginning (for prep steps)
+// Parse a duration such as "2 mins", "30 secs", "1 hr" or "3-4 minutes"
+// into seconds. The first number counts; a missing unit means minutes.
+// Returns 0 if there is no number
+// Time Complexity: O(length)
+int parseDuration(const char *text) {
+    while (*text != '\0' && !isdigit((unsigned char)*text)) text++;
+    if (*text == '\0') return 0;
+    
+    int amount = 0;
+    while (isdigit((unsigned char)*text)) amount = amount * 10 + (*text++ - '0');
+    while (*text != '\0' && !isalpha((unsigned char)*text)) text++;  // skip "-4 ", spaces
+    
+    switch (tolower((unsigned char)*text)) {
+        case 's': return amount;
+        case 'h': return amount * 3600;
+        default:  return amount * 60;   // "min", "minutes" or no unit
+    }
+}
+
+// Total cooking time of a recipe
 // Time Complexity: O(1)
-// Space Complexity: O(1)
-void insertAtBeginning(StepNode **head, int number, char *instruction, char *time) {
-    StepNode *newStep = createStep(number, instruction, time);
-    newStep->next = *head;
-    *head = newStep;
-    printf("✅ Inserted at beginning: %s\n", instruction);
+long recipeSeconds(Recipe *recipe) {
+    return recipe->totalSeconds;
 }
 
-// Insert step at end (most common - adding final steps)
+// Total cooking time of many recipes at once (for ranking by cookTime)
 // Time Complexity: O(n)
-// Space Complexity: O(1)
-void insertAtEnd(StepNode **head, int number, char *instruction, char *time) {
-    StepNode *newStep = createStep(number, instruction, time);
-    
-    if (*head == NULL) {
-        *head = newStep;
-        return;
+void recipeSecondsBatch(Recipe *recipes, int n, long *seconds) {
+    for (int i = 0; i < n; i++) {
+        seconds[i] = recipes[i].totalSeconds;
+    }
+}
+
+// Count total steps
+// Time Complexity: O(1)
+int countSteps(Recipe *recipe) {
+    return recipe->capacity - (recipe->gapEnd - recipe->gapStart);
+}
+
+// Step at position index (0-based), NULL if out of range
+// Pointers into the recipe stay valid until the next insert or delete
+// Time Complexity: O(1)
+StepNode* getStep(Recipe *recipe, int index) {
+    if (index < 0 || index >= countSteps(recipe)) return NULL;
+    if (index >= recipe->gapStart) index += recipe->gapEnd - recipe->gapStart;
+    return &recipe->steps[index];
+}
+
+// Position of a step pointer returned by getStep/searchStep
+int stepPosition(Recipe *recipe, StepNode *step) {
+    int slot = (int)(step - recipe->steps);
+    return slot < recipe->gapStart ? slot : slot - (recipe->gapEnd - recipe->gapStart);
+}
+
+// Move the gap so it starts at position
+// Time Complexity: O(|position - gapStart|)
+void moveGap(Recipe *recipe, int position) {
+    int gap = recipe->gapEnd - recipe->gapStart;
+    if (position < recipe->gapStart) {
+        int moved = recipe->gapStart - position;
+        memmove(&recipe->steps[recipe->gapEnd - moved], &recipe->steps[position],
+                moved * sizeof(StepNode));
+    } else if (position > recipe->gapStart) {
+        int moved = position - recipe->gapStart;
+        memmove(&recipe->steps[recipe->gapStart], &recipe->steps[recipe->gapEnd],
+                moved * sizeof(StepNode));
     }
+    recipe->gapStart = position;
+    recipe->gapEnd = position + gap;
+}
+
+// Double the buffer, keeping the gap in place
+// Returns 0 on success, -1 if out of memory
+// Time Complexity: O(n), amortized O(1) per insert
+int growRecipe(Recipe *recipe) {
+    int newCapacity = recipe->capacity > 0 ? recipe->capacity * 2 : INITIAL_STEPS;
+    StepNode *grown = (StepNode*)realloc(recipe->steps, newCapacity * sizeof(StepNode));
+    if (grown == NULL) {
+        printf("❌ Memory allocation failed!\n");
+        return -1;
+    }
+    int tail = recipe->capacity - recipe->gapEnd;
+    memmove(&grown[newCapacity - tail], &grown[recipe->gapEnd], tail * sizeof(StepNode));
+    recipe->steps = grown;
+    recipe->gapEnd = newCapacity - tail;
+    recipe->capacity = newCapacity;
+    return 0;
+}
+
+// Insert a step so it ends up at position
+// Time Complexity: O(1) amortized at the end or next to the last edit,
+// O(distance moved) otherwise
+// Space Complexity: O(1) amortized
+StepNode* insertStepAt(Recipe *recipe, int position, int number, char *instruction, char *time) {
+    if (position < 0 || position > countSteps(recipe)) {
+        printf("❌ Position out of range\n");
+        return NULL;
+    }
+    if (recipe->gapStart == recipe->gapEnd && growRecipe(recipe) != 0) {
+        return NULL;
+    }
+    moveGap(recipe, position);
     
-    StepNode *temp = *head;
-    while (temp->next != NULL) {
-        temp = temp->next;
+    StepNode *newStep = &recipe->steps[recipe->gapStart++];
+    newStep->stepNumber = number;
+    newStep->instruction = internString(&stepText, instruction);
+    newStep->timeEstimate = internString(&stepText, time);
+    newStep->seconds = parseDuration(time);
+    recipe->totalSeconds += newStep->seconds;
+    return newStep;
+}
+
+// Insert step at beginning (for prep steps)
+// Time Complexity: O(n) worst case (gap move), O(1) for repeated prepends
+// Space Complexity: O(1) amortized
+void insertAtBeginning(Recipe *recipe, int number, char *instruction, char *time) {
+    if (insertStepAt(recipe, 0, number, instruction, time) != NULL) {
+        printf("✅ Inserted at beginning: %s\n", instruction);
     }
-    temp->next = newStep;
 }
 
-// Insert step after specific position
-// Time Complexity: O(n)
-// Space Complexity: O(1)
-void insertAfter(StepNode *prevStep, int number, char *instruction, char *time) {
+// Insert step at end (most common - adding final steps)
+// Time Complexity: O(1) amortized
+// Space Complexity: O(1) amortized
+void insertAtEnd(Recipe *recipe, int number, char *instruction, char *time) {
+    insertStepAt(recipe, countSteps(recipe), number, instruction, time);
+}
+
+// Insert step after specific step (from getStep/searchStep)
+// Time Complexity: O(distance from the last edit)
+// Space Complexity: O(1) amortized
+void insertAfter(Recipe *recipe, StepNode *prevStep, int number, char *instruction, char *time) {
     if (prevStep == NULL) {
         printf("❌ Previous step cannot be NULL\n");
         return;
     }
     
-    StepNode *newStep = createStep(number, instruction, time);
-    newStep->next = prevStep->next;
-    prevStep->next = newStep;
-    printf("✅ Inserted after step: %s\n", instruction);
+    if (insertStepAt(recipe, stepPosition(recipe, prevStep) + 1, number, instruction, time) != NULL) {
+        printf("✅ Inserted after step: %s\n", instruction);
+    }
+}
+
+// Remove the step at position without printing
+// Returns 0 on success, -1 if position is out of range
+// Time Complexity: O(distance from the last edit)
+int removeStepAt(Recipe *recipe, int position) {
+    if (position < 0 || position >= countSteps(recipe)) return -1;
+    moveGap(recipe, position);
+    recipe->totalSeconds -= recipe->steps[recipe->gapEnd].seconds;
+    recipe->gapEnd++;  // the step after the gap joins it
+    return 0;
 }
 
 // Delete step at specific position
-// Time Complexity: O(n)
+// Time Complexity: O(distance from the last edit)
 // Space Complexity: O(1)
-void deleteStep(StepNode **head, int position) {
-    if (*head == NULL) {
+void deleteStep(Recipe *recipe, int position) {
+    if (countSteps(recipe) == 0) {
         printf("❌ Recipe is empty!\n");
         return;
     }
     
-    StepNode *temp = *head;
-    
-    // Delete head
-    if (position == 0) {
-        *head = temp->next;
-        printf("🗑  Deleted: %s\n", temp->instruction);
-        free(temp);
-        return;
-    }
-    
-    // Find previous node
-    for (int i = 0; temp != NULL && i < position - 1; i++) {
-        temp = temp->next;
-    }
-    
-    if (temp == NULL || temp->next == NULL) {
+    StepNode *toDelete = getStep(recipe, position);
+    if (toDelete == NULL) {
         printf("❌ Position out of range\n");
         return;
     }
     
-    StepNode *toDelete = temp->next;
-    temp->next = toDelete->next;
-    printf("🗑  Deleted: %s\n", toDelete->instruction);
-    free(toDelete);
+    printf("🗑  Deleted: %s\n", poolString(&stepText, toDelete->instruction));
+    removeStepAt(recipe, position);
 }
 
 // Display all recipe steps
 // Time Complexity: O(n)
 // Space Complexity: O(1)
-void displayRecipe(StepNode *head, char *recipeName) {
-    if (head == NULL) {
+void displayRecipe(Recipe *recipe, char *recipeName) {
+    int count = countSteps(recipe);
+    if (count == 0) {
         printf("❌ No recipe steps available.\n");
         return;
     }
@@ -117,56 +232,31 @@ void displayRecipe(StepNode *head, char *recipeName) {
     printf("   RECIPE: %s\n", recipeName);
     printf("========================================\n\n");
     
-    StepNode *temp = head;
-    int stepCount = 1;
-    int totalTime = 0;
-    
-    while (temp != NULL) {
-        printf("Step %d: %s\n", stepCount, temp->instruction);
-        printf("  ⏱  Time: %s\n\n", temp->timeEstimate);
-        
-        // Calculate total time (extract number from time string)
-        int mins;
-        if (sscanf(temp->timeEstimate, "%d", &mins) == 1) {
-            totalTime += mins;
-        }
-        
-        temp = temp->next;
-        stepCount++;
+    for (int i = 0; i < count; i++) {
+        StepNode *step = getStep(recipe, i);
+        printf("Step %d: %s\n", i + 1, poolString(&stepText, step->instruction));
+        printf("  ⏱  Time: %s\n\n", poolString(&stepText, step->timeEstimate));
     }
     
+    long total = recipeSeconds(recipe);
     printf("========================================\n");
-    printf("Total Steps: %d | Total Time: ~%d mins\n", stepCount - 1, totalTime);
+    printf("Total Steps: %d | Total Time: %ld min %ld sec\n", count, total / 60, total % 60);
     printf("========================================\n\n");
 }
 
-// Count total steps
-// Time Complexity: O(n)
-// Space Complexity: O(1)
-int countSteps(StepNode *head) {
-    int count = 0;
-    StepNode *temp = head;
-    while (temp != NULL) {
-        count++;
-        temp = temp->next;
-    }
-    return count;
-}
-
 // Search for specific keyword in steps
 // Time Complexity: O(n)
 // Space Complexity: O(1)
-StepNode* searchStep(StepNode *head, char *keyword) {
-    StepNode *temp = head;
-    int position = 1;
-    
-    while (temp != NULL) {
-        if (strstr(temp->instruction, keyword) != NULL) {
-            printf("🔍 Found '%s' in Step %d: %s\n", keyword, position, temp->instruction);
-            return temp;
+StepNode* searchStep(Recipe *recipe, char *keyword) {
+    int count = countSteps(recipe);
+    
+    for (int i = 0; i < count; i++) {
+        StepNode *step = getStep(recipe, i);
+        const char *instruction = poolString(&stepText, step->instruction);
+        if (strstr(instruction, keyword) != NULL) {
+            printf("🔍 Found '%s' in Step %d: %s\n", keyword, i + 1, instruction);
+            return step;
         }
-        temp = temp->next;
-        position++;
     }
     
     printf("❌ Keyword '%s' not found in recipe\n", keyword);
@@ -174,39 +264,200 @@ StepNode* searchStep(StepNode *head, char *keyword) {
 }
 
 // Reverse recipe (useful for showing steps in reverse order)
+// The total time does not change
 // Time Complexity: O(n)
 // Space Complexity: O(1)
-void reverseRecipe(StepNode **head) {
-    StepNode *prev = NULL;
-    StepNode *current = *head;
-    StepNode *next = NULL;
-    
-    while (current != NULL) {
-        next = current->next;
-        current->next = prev;
-        prev = current;
-        current = next;
-    }
+void reverseRecipeSilently(Recipe *recipe) {
+    int count = countSteps(recipe);
+    moveGap(recipe, count);  // steps become one contiguous run
     
-    *head = prev;
+    for (int i = 0, j = count - 1; i < j; i++, j--) {
+        StepNode temp = recipe->steps[i];
+        recipe->steps[i] = recipe->steps[j];
+        recipe->steps[j] = temp;
+    }
+}
+
+void reverseRecipe(Recipe *recipe) {
+    reverseRecipeSilently(recipe);
     printf("🔄 Recipe steps reversed!\n");
 }
 
-// Free all nodes (cleanup)
-void freeRecipe(StepNode **head) {
-    StepNode *temp;
-    while (*head != NULL) {
-        temp = *head;
-        *head = (*head)->next;
-        free(temp);
+// Free all steps (cleanup)
+// Time Complexity: O(1)
+void freeRecipe(Recipe *recipe) {
+    free(recipe->steps);
+    initRecipe(recipe);
+}
+
+// ================= BENCHMARK: LINKED LIST vs GAP BUFFER =================
+// Baseline is the original singly linked list (tail walk on every append,
+// position walk on every access/delete), with nodes from a slab pool so
+// only the layout differs.
+
+typedef struct ListStep {
+    int stepNumber;
+    StringId instruction;
+    StringId timeEstimate;
+    struct ListStep *next;
+} ListStep;
+
+double elapsedMs(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+// Append n steps, read queries steps by position, delete deletes steps
+// from the middle
+void benchmarkRecipes(int n, int queries, int deletes) {
+    StringId instruction = internString(&stepText, "Stir and simmer");
+    StringId time = internString(&stepText, "1 min");
+    long checksumList = 0, checksumGap = 0;
+    
+    // Linked list
+    SlabPool nodes;
+    initSlabPool(&nodes, sizeof(ListStep), 1024);
+    ListStep *head = NULL;
+    clock_t start = clock();
+    for (int i = 0; i < n; i++) {
+        ListStep *step = (ListStep*)slabAlloc(&nodes);
+        step->stepNumber = i;
+        step->instruction = instruction;
+        step->timeEstimate = time;
+        step->next = NULL;
+        if (head == NULL) {
+            head = step;
+            continue;
+        }
+        ListStep *temp = head;
+        while (temp->next != NULL) temp = temp->next;
+        temp->next = step;
+    }
+    double listAppend = elapsedMs(start);
+    
+    start = clock();
+    for (int q = 0; q < queries; q++) {
+        ListStep *temp = head;
+        for (int i = (int)(((long)q * 7919) % n); i > 0; i--) temp = temp->next;
+        checksumList += temp->stepNumber;
+    }
+    double listIndex = elapsedMs(start);
+    
+    start = clock();
+    for (int d = 0; d < deletes; d++) {
+        ListStep *prev = head;
+        for (int i = (n - d) / 2 - 1; i > 0; i--) prev = prev->next;
+        ListStep *toDelete = prev->next;
+        prev->next = toDelete->next;
+        slabFree(&nodes, toDelete);
+    }
+    double listDelete = elapsedMs(start);
+    for (ListStep *temp = head; temp != NULL; temp = temp->next) checksumList += temp->stepNumber;
+    freeSlabPool(&nodes);
+    
+    // Gap buffer
+    Recipe recipe;
+    initRecipe(&recipe);
+    start = clock();
+    for (int i = 0; i < n; i++) {
+        insertAtEnd(&recipe, i, "Stir and simmer", "1 min");
+    }
+    double gapAppend = elapsedMs(start);
+    
+    start = clock();
+    for (int q = 0; q < queries; q++) {
+        checksumGap += getStep(&recipe, (int)(((long)q * 7919) % n))->stepNumber;
+    }
+    double gapIndex = elapsedMs(start);
+    
+    start = clock();
+    for (int d = 0; d < deletes; d++) {
+        removeStepAt(&recipe, (n - d) / 2);
+    }
+    double gapDelete = elapsedMs(start);
+    for (int i = 0; i < countSteps(&recipe); i++) checksumGap += getStep(&recipe, i)->stepNumber;
+    freeRecipe(&recipe);
+    
+    printf("=== BENCHMARK: %d steps, %d indexed reads, %d middle deletes ===\n", n, queries, deletes);
+    printf("linked list: append %8.1f ms | index %8.1f ms | delete %8.1f ms\n",
+           listAppend, listIndex, listDelete);
+    printf("gap buffer : append %8.1f ms | index %8.1f ms | delete %8.1f ms\n",
+           gapAppend, gapIndex, gapDelete);
+    printf("Same steps: %s\n\n", checksumList == checksumGap ? "Yes" : "No");
+}
+
+// ================= BENCHMARK: RECIPE TIME TOTALS =================
+
+// Old displayRecipe total: sscanf every timeEstimate (and count it as minutes)
+long rescanMinutes(Recipe *recipe) {
+    long total = 0;
+    for (int i = 0; i < countSteps(recipe); i++) {
+        int mins;
+        if (sscanf(poolString(&stepText, getStep(recipe, i)->timeEstimate), "%d", &mins) == 1) {
+            total += mins;
+        }
     }
+    return total;
 }
 
-// Main function demonstrating Linked List operations
+// numRecipes recipes of stepsEach steps, edited at random; compare the
+// running totals against a re-parse and time both ways of ranking them
+void benchmarkCookTime(int numRecipes, int stepsEach, int rounds) {
+    char *times[] = { "30 secs", "1 min", "2 mins", "5 mins", "15 mins", "1 hr" };
+    Recipe *recipes = (Recipe*)malloc(numRecipes * sizeof(Recipe));
+    long *seconds = (long*)malloc(numRecipes * sizeof(long));
+    srand(11);
+    for (int r = 0; r < numRecipes; r++) {
+        initRecipe(&recipes[r]);
+        for (int i = 0; i < stepsEach; i++) {
+            insertAtEnd(&recipes[r], i, "Stir and simmer", times[rand() % 6]);
+        }
+        // Edits that the running total has to follow
+        removeStepAt(&recipes[r], rand() % stepsEach);
+        insertStepAt(&recipes[r], rand() % stepsEach, 0, "Taste and adjust", times[rand() % 6]);
+        if (r % 2 == 0) reverseRecipeSilently(&recipes[r]);
+    }
+    
+    int consistent = 1;
+    for (int r = 0; r < numRecipes; r++) {
+        long expected = 0;
+        for (int i = 0; i < countSteps(&recipes[r]); i++) {
+            expected += parseDuration(poolString(&stepText, getStep(&recipes[r], i)->timeEstimate));
+        }
+        if (expected != recipeSeconds(&recipes[r])) consistent = 0;
+    }
+    
+    long checksumScan = 0, checksumBatch = 0;
+    clock_t start = clock();
+    for (int round = 0; round < rounds; round++) {
+        for (int r = 0; r < numRecipes; r++) checksumScan += rescanMinutes(&recipes[r]);
+    }
+    double scanMs = elapsedMs(start);
+    
+    start = clock();
+    for (int round = 0; round < rounds; round++) {
+        recipeSecondsBatch(recipes, numRecipes, seconds);
+        for (int r = 0; r < numRecipes; r++) checksumBatch += seconds[r];
+    }
+    double batchMs = elapsedMs(start);
+    
+    printf("=== BENCHMARK: cook time of %d recipes x %d steps, %d rounds ===\n",
+           numRecipes, stepsEach, rounds);
+    printf("sscanf every step   : %8.2f ms (minutes only, checksum %ld)\n", scanMs, checksumScan);
+    printf("running totals batch: %8.2f ms (seconds, checksum %ld)\n", batchMs, checksumBatch);
+    printf("Running totals match a full re-parse: %s\n\n", consistent ? "Yes" : "No");
+    
+    for (int r = 0; r < numRecipes; r++) freeRecipe(&recipes[r]);
+    free(recipes);
+    free(seconds);
+}
+
+// Main function demonstrating recipe step operations
 int main() {
-    StepNode *paneerRecipe = NULL;
+    Recipe paneerRecipe;
+    if (initStringPool(&stepText) != 0) return 1;
+    initRecipe(&paneerRecipe);
     
-    printf("\n=== NutriPlan Recipe Management System (Linked List) ===\n\n");
+    printf("\n=== NutriPlan Recipe Management System (Gap Buffer) ===\n\n");
     
     // Build Paneer Bhurji recipe step by step
     printf("--- BUILDING PANEER BHURJI RECIPE ---\n\n");
@@ -223,31 +474,32 @@ int main() {
     insertAtEnd(&paneerRecipe, 10, "Serve hot with roti or bread", "0 mins");
     
     // Display complete recipe
-    displayRecipe(paneerRecipe, "Paneer Bhurji");
+    displayRecipe(&paneerRecipe, "Paneer Bhurji");
     
     // Count steps
-    printf("Total steps in recipe: %d\n\n", countSteps(paneerRecipe));
+    printf("Total steps in recipe: %d\n\n", countSteps(&paneerRecipe));
     
     // Search for a step
     printf("--- SEARCHING FOR STEPS ---\n");
-    searchStep(paneerRecipe, "tomatoes");
-    searchStep(paneerRecipe, "salt");  // Not found
+    searchStep(&paneerRecipe, "tomatoes");
+    searchStep(&paneerRecipe, "salt");  // Not found
     printf("\n");
     
     // Modify recipe - add a forgotten step at beginning
     printf("--- ADDING PREP STEP AT BEGINNING ---\n");
     insertAtBeginning(&paneerRecipe, 0, "Gather all ingredients and keep ready", "2 mins");
-    displayRecipe(paneerRecipe, "Paneer Bhurji (Updated)");
+    displayRecipe(&paneerRecipe, "Paneer Bhurji (Updated)");
     
     // Delete a step (remove cumin for simpler version)
     printf("--- CREATING SIMPLIFIED VERSION ---\n");
     printf("Removing cumin step for quick recipe...\n");
     deleteStep(&paneerRecipe, 3);  // Index 3 = 4th step (after adding prep)
-    displayRecipe(paneerRecipe, "Paneer Bhurji (Quick Version)");
+    displayRecipe(&paneerRecipe, "Paneer Bhurji (Quick Version)");
     
     // Create another recipe - Dal Tadka
     printf("\n--- CREATING DAL TADKA RECIPE ---\n\n");
-    StepNode *dalRecipe = NULL;
+    Recipe dalRecipe;
+    initRecipe(&dalRecipe);
     
     insertAtEnd(&dalRecipe, 1, "Pressure cook toor dal with turmeric for 3 whistles", "15 mins");
     insertAtEnd(&dalRecipe, 2, "Mash the dal until smooth", "2 mins");
@@ -257,24 +509,37 @@ int main() {
     insertAtEnd(&dalRecipe, 6, "Pour tadka over dal and mix", "1 min");
     insertAtEnd(&dalRecipe, 7, "Garnish with coriander and serve hot", "0 mins");
     
-    displayRecipe(dalRecipe, "Dal Tadka");
+    displayRecipe(&dalRecipe, "Dal Tadka");
     
     // Demonstrate insertion after specific step
     printf("--- INSERTING STEP AFTER 'Add tomatoes' ---\n");
-    StepNode *tomatoStep = searchStep(dalRecipe, "tomatoes");
+    StepNode *tomatoStep = searchStep(&dalRecipe, "tomatoes");
     if (tomatoStep != NULL) {
-        insertAfter(tomatoStep, 6, "Add garam masala and salt to taste", "30 secs");
+        insertAfter(&dalRecipe, tomatoStep, 6, "Add garam masala and salt to taste", "30 secs");
     }
-    displayRecipe(dalRecipe, "Dal Tadka (Enhanced)");
+    displayRecipe(&dalRecipe, "Dal Tadka (Enhanced)");
+    
+    // Jump straight to a step by position
+    printf("--- STEP 3 OF DAL TADKA (INDEXED) ---\n");
+    printf("%s\n\n", poolString(&stepText, getStep(&dalRecipe, 2)->instruction));
+    
+    reverseRecipe(&dalRecipe);
+    printf("Last step now first: %s\n\n", poolString(&stepText, getStep(&dalRecipe, 0)->instruction));
     
     // Cleanup
     printf("--- CLEANING UP MEMORY ---\n");
     freeRecipe(&paneerRecipe);
     freeRecipe(&dalRecipe);
-    printf("✅ All recipes freed from memory\n\n");
+    printf("✅ All recipes freed from memory\n");
+    printf("Step record: %zu bytes (was %zu with char[200]/char[20] text and a next pointer)\n\n",
+           sizeof(StepNode), sizeof(int) + 200 + 20 + sizeof(StepNode*));
+    
+    benchmarkRecipes(20000, 20000, 2000);
+    benchmarkCookTime(5000, 12, 20);
+    freeStringPool(&stepText);
     
-    printf("=== Linked List demonstration complete! ===\n");
-    printf("Key advantages: Dynamic size, easy insertion/deletion anywhere\n\n");
+    printf("=== Recipe steps demonstration complete! ===\n");
+    printf("Key advantages: Dynamic size, O(1) append and indexed access, cheap local edits\n\n");
     
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,386 @@
+// Lock-Free Meal-Log Ingestion Queue (Bounded MPSC Ring Buffer)
+// NutriPlan - Data Structures Project
+// Request threads hand logged meals (what addMeal in meals.html builds:
+// name, calories, protein, carbs, timestamp) to the one thread that
+// aggregates and persists them. Producers claim a slot with one CAS on
+// the tail; every slot carries a turn number that says whether it
+// is free, being written or ready, so the consumer never locks and never
+// reads a half-written event. A full ring is reported to the producer
+// (backpressure) instead of growing or blocking.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <time.h>
+
+#define MEAL_NAME_SIZE 24       // keeps event + turn in one 64-byte slot
+#define CACHE_LINE 64
+#define MAX_THREADS 64
+#define DRAIN_BATCH 64
+
+#define QUEUE_OK 0
+#define QUEUE_FULL (-1)      // backpressure: retry later or shed the event
+
+// One logged meal, fixed size so it is copied straight into a slot
+typedef struct {
+    char name[MEAL_NAME_SIZE];
+    int32_t calories;
+    float protein;
+    float carbs;
+    uint32_t producer;       // stress test bookkeeping
+    int64_t ts;              // milliseconds, as Date.now() (meal_stats wants secondsFromMillis(ts))
+    uint64_t sequence;       // per-producer counter (stress test)
+} MealEvent;
+
+typedef struct {
+    uint64_t turn;           // == position: free; position + 1: ready to read
+    MealEvent event;
+} __attribute__((aligned(CACHE_LINE))) QueueSlot;
+
+typedef struct {
+    QueueSlot *slots;
+    uint64_t mask;           // capacity - 1 (capacity is a power of two)
+    // Producers and the consumer write different cache lines
+    uint64_t tail __attribute__((aligned(CACHE_LINE)));   // next position to claim (shared)
+    uint64_t head __attribute__((aligned(CACHE_LINE)));   // next position to read (consumer only)
+    uint64_t fullSignals __attribute__((aligned(CACHE_LINE)));  // QUEUE_FULL returns
+} MealQueue;
+
+// ================= QUEUE =================
+
+// capacity is rounded up to a power of two
+// Returns 0 on success, -1 if out of memory
+int initMealQueue(MealQueue *q, uint64_t capacity) {
+    uint64_t size = 2;
+    while (size < capacity) size *= 2;
+    memset(q, 0, sizeof(MealQueue));
+    q->slots = (QueueSlot*)aligned_alloc(CACHE_LINE, size * sizeof(QueueSlot));
+    if (q->slots == NULL) {
+        printf("❌ Memory allocation failed!\n");
+        return -1;
+    }
+    for (uint64_t i = 0; i < size; i++) q->slots[i].turn = i;
+    q->mask = size - 1;
+    return 0;
+}
+
+void freeMealQueue(MealQueue *q) {
+    free(q->slots);
+    q->slots = NULL;
+}
+
+// Any number of producer threads
+// Returns QUEUE_OK, or QUEUE_FULL if every slot is still waiting for the consumer
+// Time Complexity: O(1) (one CAS, retried only if another producer won)
+int tryEnqueue(MealQueue *q, const MealEvent *event) {
+    uint64_t pos = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+    QueueSlot *slot;
+    while (1) {
+        slot = &q->slots[pos & q->mask];
+        uint64_t turn = __atomic_load_n(&slot->turn, __ATOMIC_ACQUIRE);
+        int64_t diff = (int64_t)(turn - pos);
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&q->tail, &pos, pos + 1, 1,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+            // pos now holds the current tail; try again
+        } else if (diff < 0) {
+            __atomic_fetch_add(&q->fullSignals, 1, __ATOMIC_RELAXED);
+            return QUEUE_FULL;   // the slot a lap behind has not been drained yet
+        } else {
+            pos = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+        }
+    }
+    slot->event = *event;
+    __atomic_store_n(&slot->turn, pos + 1, __ATOMIC_RELEASE);  // publish
+    return QUEUE_OK;
+}
+
+// Enqueue, yielding while the ring is full, up to maxRetries times
+// Returns QUEUE_OK, or QUEUE_FULL if the consumer never caught up
+int enqueueWithBackoff(MealQueue *q, const MealEvent *event, int maxRetries) {
+    for (int attempt = 0; ; attempt++) {
+        if (tryEnqueue(q, event) == QUEUE_OK) return QUEUE_OK;
+        if (attempt >= maxRetries) return QUEUE_FULL;
+        sched_yield();
+    }
+}
+
+// Single consumer: copy up to max ready events into out, in claim order
+// Returns the number drained (0 if nothing is ready)
+// Time Complexity: O(drained)
+int drainBatch(MealQueue *q, MealEvent *out, int max) {
+    uint64_t pos = q->head;
+    int n = 0;
+    while (n < max) {
+        QueueSlot *slot = &q->slots[pos & q->mask];
+        if (__atomic_load_n(&slot->turn, __ATOMIC_ACQUIRE) != pos + 1) break;  // empty or mid-write
+        out[n++] = slot->event;
+        // Hand the slot back to producers for the next lap
+        __atomic_store_n(&slot->turn, pos + q->mask + 1, __ATOMIC_RELEASE);
+        pos++;
+    }
+    q->head = pos;
+    return n;
+}
+
+// ================= MUTEX BASELINE =================
+
+// Same ring behind one lock
+typedef struct {
+    pthread_mutex_t lock;
+    MealEvent *events;
+    uint64_t mask;
+    uint64_t head;
+    uint64_t tail;
+    uint64_t fullSignals;
+} LockedQueue;
+
+int initLockedQueue(LockedQueue *q, uint64_t capacity) {
+    uint64_t size = 2;
+    while (size < capacity) size *= 2;
+    memset(q, 0, sizeof(LockedQueue));
+    pthread_mutex_init(&q->lock, NULL);
+    q->events = (MealEvent*)malloc(size * sizeof(MealEvent));
+    q->mask = size - 1;
+    return q->events != NULL ? 0 : -1;
+}
+
+void freeLockedQueue(LockedQueue *q) {
+    pthread_mutex_destroy(&q->lock);
+    free(q->events);
+}
+
+int lockedEnqueue(LockedQueue *q, const MealEvent *event) {
+    int result = QUEUE_FULL;
+    pthread_mutex_lock(&q->lock);
+    if (q->tail - q->head <= q->mask) {
+        q->events[q->tail++ & q->mask] = *event;
+        result = QUEUE_OK;
+    } else {
+        q->fullSignals++;
+    }
+    pthread_mutex_unlock(&q->lock);
+    return result;
+}
+
+int lockedDrain(LockedQueue *q, MealEvent *out, int max) {
+    int n = 0;
+    pthread_mutex_lock(&q->lock);
+    while (n < max && q->head != q->tail) out[n++] = q->events[q->head++ & q->mask];
+    pthread_mutex_unlock(&q->lock);
+    return n;
+}
+
+// ================= STRESS TEST AND BENCHMARK =================
+
+static const char *mealNames[] = { "Poha", "Dal Tadka", "Paneer Bhurji", "Oats Upma",
+                                   "Egg Curry", "Rajma Chawal", "Idli Sambar", "Chicken Salad" };
+
+typedef struct {
+    MealQueue *lockFree;     // exactly one of these is set
+    LockedQueue *locked;
+    int producers;
+    long eventsPerProducer;
+    int producersDone;
+    uint64_t nextProducer;
+} Pipeline;
+
+typedef struct {
+    long received;
+    long calories;
+    long outOfOrder;         // per-producer sequence went backwards or skipped
+    long batches;
+} ConsumerResult;
+
+static inline uint64_t nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static inline MealEvent makeEvent(uint32_t producer, uint64_t sequence) {
+    MealEvent e;
+    memset(&e, 0, sizeof(e));
+    uint32_t r = (uint32_t)((sequence + 1) * 2654435761u) ^ producer;
+    snprintf(e.name, MEAL_NAME_SIZE, "%s", mealNames[r % 8]);
+    e.calories = 100 + (int32_t)(r % 600);
+    e.protein = (float)(r % 40);
+    e.carbs = (float)(r % 90);
+    e.producer = producer;
+    e.ts = 1700000000000LL + (int64_t)sequence;
+    e.sequence = sequence;
+    return e;
+}
+
+// Expected calorie sum of a whole run
+long expectedCalories(int producers, long events) {
+    long total = 0;
+    for (int p = 0; p < producers; p++) {
+        for (long s = 0; s < events; s++) total += makeEvent((uint32_t)p, (uint64_t)s).calories;
+    }
+    return total;
+}
+
+void* producerWorker(void *arg) {
+    Pipeline *pipe = (Pipeline*)arg;
+    uint32_t producer = (uint32_t)__atomic_fetch_add(&pipe->nextProducer, 1, __ATOMIC_RELAXED);
+    for (long s = 0; s < pipe->eventsPerProducer; s++) {
+        MealEvent e = makeEvent(producer, (uint64_t)s);
+        // Never drop in the test: keep backing off until there is room
+        if (pipe->lockFree != NULL) {
+            while (enqueueWithBackoff(pipe->lockFree, &e, 64) != QUEUE_OK) {}
+        } else {
+            while (lockedEnqueue(pipe->locked, &e) != QUEUE_OK) sched_yield();
+        }
+    }
+    __atomic_fetch_add(&pipe->producersDone, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+// Drain until every producer has finished and the ring is empty, checking
+// that each producer's events arrive complete and in order
+void consume(Pipeline *pipe, ConsumerResult *result) {
+    MealEvent batch[DRAIN_BATCH];
+    uint64_t *nextSequence = (uint64_t*)calloc(pipe->producers, sizeof(uint64_t));
+    memset(result, 0, sizeof(ConsumerResult));
+    while (1) {
+        int done = __atomic_load_n(&pipe->producersDone, __ATOMIC_ACQUIRE) == pipe->producers;
+        int n = pipe->lockFree != NULL ? drainBatch(pipe->lockFree, batch, DRAIN_BATCH)
+                                       : lockedDrain(pipe->locked, batch, DRAIN_BATCH);
+        if (n == 0) {
+            if (done) break;  // nothing was in flight when the last producer finished
+            sched_yield();
+            continue;
+        }
+        result->batches++;
+        for (int i = 0; i < n; i++) {
+            const MealEvent *e = &batch[i];
+            if (e->producer >= (uint32_t)pipe->producers || e->sequence != nextSequence[e->producer]) {
+                result->outOfOrder++;
+            } else {
+                nextSequence[e->producer]++;
+            }
+            result->calories += e->calories;
+        }
+        result->received += n;
+    }
+    free(nextSequence);
+}
+
+// Returns events per second; *ok is cleared if anything was lost,
+// duplicated or reordered
+double runPipeline(int lockFree, int producers, long eventsPerProducer, uint64_t capacity,
+                   long expected, uint64_t *fullSignals, double *eventsPerBatch, int *ok) {
+    MealQueue ring;
+    LockedQueue locked;
+    Pipeline pipe;
+    memset(&pipe, 0, sizeof(pipe));
+    pipe.producers = producers;
+    pipe.eventsPerProducer = eventsPerProducer;
+    if (lockFree) {
+        if (initMealQueue(&ring, capacity) != 0) return 0.0;
+        pipe.lockFree = &ring;
+    } else {
+        if (initLockedQueue(&locked, capacity) != 0) return 0.0;
+        pipe.locked = &locked;
+    }
+
+    pthread_t threads[MAX_THREADS];
+    int started = 0;
+    uint64_t start = nowNs();
+    for (int p = 0; p < producers; p++) {
+        if (pthread_create(&threads[started], NULL, producerWorker, &pipe) == 0) started++;
+    }
+    if (started < producers) {
+        printf("❌ Could only start %d of %d producers\n", started, producers);
+        pipe.producers = started;
+    }
+    ConsumerResult result;
+    consume(&pipe, &result);
+    double seconds = (nowNs() - start) / 1e9;
+    for (int t = 0; t < started; t++) pthread_join(threads[t], NULL);
+
+    long total = (long)pipe.producers * eventsPerProducer;
+    if (result.received != total || result.outOfOrder != 0 ||
+        (pipe.producers == producers && result.calories != expected)) *ok = 0;
+    *fullSignals = lockFree ? ring.fullSignals : locked.fullSignals;
+    *eventsPerBatch = result.batches > 0 ? (double)result.received / result.batches : 0.0;
+
+    if (lockFree) freeMealQueue(&ring);
+    else freeLockedQueue(&locked);
+    return total / seconds;
+}
+
+// Many producers on a tiny ring, so it is full most of the time
+int stressTest(int producers, long eventsPerProducer) {
+    printf("=== STRESS TEST: %d producers x %ld events through a 16-slot ring ===\n",
+           producers, eventsPerProducer);
+    long expected = expectedCalories(producers, eventsPerProducer);
+    int ok = 1;
+    uint64_t fullSignals;
+    double perBatch;
+    for (int round = 0; round < 3; round++) {
+        runPipeline(1, producers, eventsPerProducer, 16, expected, &fullSignals, &perBatch, &ok);
+        printf("Round %d: %llu backpressure signals, %.1f events per drained batch\n",
+               round + 1, (unsigned long long)fullSignals, perBatch);
+    }
+    printf("Every event delivered exactly once, in per-producer order: %s\n\n", ok ? "Yes" : "No");
+    return ok;
+}
+
+int defaultThreads(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus < 1 ? 1 : cpus > MAX_THREADS ? MAX_THREADS : (int)cpus;
+}
+
+void benchmarkQueue(long eventsPerProducer, uint64_t capacity) {
+    int cpus = defaultThreads();
+    printf("=== BENCHMARK: %ld events per producer, %llu-slot ring (%d CPU(s)) ===\n",
+           eventsPerProducer, (unsigned long long)capacity, cpus);
+    printf("%10s %-10s %14s %14s %10s\n", "Producers", "Queue", "events/sec", "full signals", "per batch");
+    int ok = 1;
+    for (int producers = 1; producers <= 8; producers *= 2) {
+        long expected = expectedCalories(producers, eventsPerProducer);
+        for (int lockFree = 0; lockFree <= 1; lockFree++) {
+            uint64_t fullSignals;
+            double perBatch;
+            double rate = runPipeline(lockFree, producers, eventsPerProducer, capacity, expected,
+                                      &fullSignals, &perBatch, &ok);
+            printf("%10d %-10s %14.0f %14llu %10.1f\n", producers, lockFree ? "lock-free" : "mutex",
+                   rate, (unsigned long long)fullSignals, perBatch);
+        }
+    }
+    if (cpus == 1) printf("(1 CPU: producers and the consumer take turns rather than contend)\n");
+    printf("Same events received: %s\n\n", ok ? "Yes" : "No");
+}
+
+// Build: gcc -O2 -pthread meal_queue.c
+int main(void) {
+    printf("\n=== NutriPlan Meal-Log Ingestion Queue (Lock-Free MPSC Ring) ===\n\n");
+
+    MealQueue q;
+    if (initMealQueue(&q, 4) != 0) return 1;
+    printf("Event: %zu bytes, slot: %zu bytes, capacity: %llu\n",
+           sizeof(MealEvent), sizeof(QueueSlot), (unsigned long long)(q.mask + 1));
+    for (uint64_t s = 0; s < 6; s++) {
+        MealEvent e = makeEvent(0, s);
+        int status = tryEnqueue(&q, &e);
+        printf("📥 %-14s %4d kcal -> %s\n", e.name, e.calories, status == QUEUE_OK ? "queued" : "FULL (backpressure)");
+    }
+    MealEvent batch[DRAIN_BATCH];
+    int n = drainBatch(&q, batch, DRAIN_BATCH);
+    printf("📤 Drained %d events in one batch:", n);
+    for (int i = 0; i < n; i++) printf(" %s", batch[i].name);
+    printf("\n\n");
+    freeMealQueue(&q);
+
+    int passed = stressTest(8, 100000);
+    benchmarkQueue(500000, 4096);
+
+    printf("=== Meal events handed off without locks (%s) ===\n\n", passed ? "stress test passed" : "STRESS TEST FAILED");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,191 @@
+// Meal Scoring Rules and Bounded Top-K Selection
+// NutriPlan - Data Structures Project
+// The one definition of how a meal is scored for a goal, plus the
+// size-K min-heap every ranking program keeps its best rows in. The
+// per-meal, per-goal batch and all-goals forms all go through scoreMeal,
+// so the rules cannot drift apart between programs.
+
+#ifndef MEAL_SCORING_H
+#define MEAL_SCORING_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "string_pool.h"   // Goal, goalName, parseGoal
+
+// ================= SCORING =================
+
+// Score one meal for one goal rule
+// Time Complexity: O(1)
+static inline int scoreMeal(Goal goal, int calories, float protein, float carbs) {
+    switch (goal) {
+        case GOAL_WEIGHT_LOSS: return (int)(protein * 3) - (calories / 10);   // high protein, low calories
+        case GOAL_MUSCLE_GAIN: return (int)(protein * 4) + (calories / 20);   // high protein, moderate calories
+        case GOAL_MAINTAIN: return (int)(protein * 2.5);                      // balanced
+        case GOAL_PCOD: return (int)(protein * 2) - (int)(carbs / 5);         // low carbs, moderate protein
+        default: return (int)(protein * 2);
+    }
+}
+
+// Score by goal string (unknown goals such as "eat-better" use the default rule)
+// Time Complexity: O(1), but resolves the string on every call
+static inline int calculateScore(const char *goal, int calories, float protein, float carbs) {
+    return scoreMeal(parseGoal(goal), calories, protein, carbs);
+}
+
+// Score n meals for one goal into scores[]. The goal is constant inside
+// each loop, so scoreMeal folds to one branch-free expression and the
+// loop vectorizes
+// Time Complexity: O(n)
+static inline void scoreBatch(Goal goal, const int *restrict calories, const float *restrict protein,
+                              const float *restrict carbs, int n, int *restrict scores) {
+    switch (goal) {
+        case GOAL_WEIGHT_LOSS:
+            for (int i = 0; i < n; i++) scores[i] = scoreMeal(GOAL_WEIGHT_LOSS, calories[i], protein[i], carbs[i]);
+            break;
+        case GOAL_MUSCLE_GAIN:
+            for (int i = 0; i < n; i++) scores[i] = scoreMeal(GOAL_MUSCLE_GAIN, calories[i], protein[i], carbs[i]);
+            break;
+        case GOAL_MAINTAIN:
+            for (int i = 0; i < n; i++) scores[i] = scoreMeal(GOAL_MAINTAIN, calories[i], protein[i], carbs[i]);
+            break;
+        case GOAL_PCOD:
+            for (int i = 0; i < n; i++) scores[i] = scoreMeal(GOAL_PCOD, calories[i], protein[i], carbs[i]);
+            break;
+        default:
+            for (int i = 0; i < n; i++) scores[i] = scoreMeal(GOAL_DEFAULT, calories[i], protein[i], carbs[i]);
+            break;
+    }
+}
+
+// Score n meals for every goal in one pass over the inputs
+// matrix is NUM_GOALS x n, row g = goal g (matrix[g * n + i])
+// Time Complexity: O(NUM_GOALS * n)
+static inline void scoreAllGoals(const int *restrict calories, const float *restrict protein,
+                                 const float *restrict carbs, int n, int *restrict matrix) {
+    int *restrict weightLoss = matrix + (size_t)GOAL_WEIGHT_LOSS * n;
+    int *restrict muscleGain = matrix + (size_t)GOAL_MUSCLE_GAIN * n;
+    int *restrict maintain = matrix + (size_t)GOAL_MAINTAIN * n;
+    int *restrict pcod = matrix + (size_t)GOAL_PCOD * n;
+    int *restrict balanced = matrix + (size_t)GOAL_DEFAULT * n;
+
+    for (int i = 0; i < n; i++) {
+        int c = calories[i];
+        float p = protein[i], k = carbs[i];
+        weightLoss[i] = scoreMeal(GOAL_WEIGHT_LOSS, c, p, k);
+        muscleGain[i] = scoreMeal(GOAL_MUSCLE_GAIN, c, p, k);
+        maintain[i] = scoreMeal(GOAL_MAINTAIN, c, p, k);
+        pcod[i] = scoreMeal(GOAL_PCOD, c, p, k);
+        balanced[i] = scoreMeal(GOAL_DEFAULT, c, p, k);
+    }
+}
+
+// ================= BOUNDED TOP-K SELECTION =================
+// Only the best K (score, row id) pairs are kept, in a min-heap whose
+// root is the weakest of the current top K.
+
+// Scored catalogue row (8 bytes, same layout as NprecEntry)
+typedef struct {
+    int32_t score;
+    uint32_t rowId;
+} ScoredRow;
+
+typedef struct {
+    ScoredRow *heap;
+    int size;
+    int k;
+} TopKSelector;
+
+// Higher score wins; ties go to the lower row id so results are stable
+static inline int rankedHigher(ScoredRow a, ScoredRow b) {
+    return a.score > b.score || (a.score == b.score && a.rowId < b.rowId);
+}
+
+// qsort comparator, best first
+static inline int compareScoredRows(const void *a, const void *b) {
+    ScoredRow x = *(const ScoredRow*)a;
+    ScoredRow y = *(const ScoredRow*)b;
+    return rankedHigher(x, y) ? -1 : (rankedHigher(y, x) ? 1 : 0);
+}
+
+// Selector over caller-owned storage for k rows
+static inline void initTopKIn(TopKSelector *sel, ScoredRow *storage, int k) {
+    sel->heap = storage;
+    sel->size = 0;
+    sel->k = k;
+}
+
+// Selector with its own heap
+// Returns 0 on success, -1 if out of memory
+// Space Complexity: O(k)
+static inline int initTopK(TopKSelector *sel, int k) {
+    initTopKIn(sel, (ScoredRow*)malloc((k > 0 ? k : 1) * sizeof(ScoredRow)), k);
+    return sel->heap == NULL ? -1 : 0;
+}
+
+static inline void freeTopK(TopKSelector *sel) {
+    free(sel->heap);
+    sel->heap = NULL;
+    sel->size = 0;
+}
+
+// Move the hole at index down until entry fits
+// Time Complexity: O(log k)
+static inline void topKSiftDown(TopKSelector *sel, int index, ScoredRow entry) {
+    while (1) {
+        int child = 2 * index + 1;
+        if (child >= sel->size) break;
+        if (child + 1 < sel->size && rankedHigher(sel->heap[child], sel->heap[child + 1])) {
+            child++;  // weaker child
+        }
+        if (!rankedHigher(entry, sel->heap[child])) break;
+        sel->heap[index] = sel->heap[child];
+        index = child;
+    }
+    sel->heap[index] = entry;
+}
+
+// Offer one scored row
+// Time Complexity: O(1) when rejected, O(log k) when kept
+static inline void offerTopK(TopKSelector *sel, int score, uint32_t rowId) {
+    ScoredRow entry = { score, rowId };
+
+    if (sel->size < sel->k) {
+        int index = sel->size++;
+        while (index > 0) {
+            int parent = (index - 1) / 2;
+            if (!rankedHigher(sel->heap[parent], entry)) break;
+            sel->heap[index] = sel->heap[parent];
+            index = parent;
+        }
+        sel->heap[index] = entry;
+    } else if (sel->k > 0 && rankedHigher(entry, sel->heap[0])) {
+        topKSiftDown(sel, 0, entry);
+    }
+}
+
+// Sort the heap in place, best first, and empty the selector
+// Returns the number of rows
+// Time Complexity: O(k log k)
+static inline int sortTopK(TopKSelector *sel) {
+    int count = sel->size;
+    ScoredRow *heap = sel->heap;
+    while (sel->size > 1) {
+        ScoredRow last = heap[--sel->size];
+        heap[sel->size] = heap[0];  // weakest remaining goes last
+        topKSiftDown(sel, 0, last);
+    }
+    sel->size = 0;
+    return count;
+}
+
+// Copy the best rows into out[], best first; returns number of rows
+// Time Complexity: O(k log k)
+static inline int finishTopK(TopKSelector *sel, ScoredRow *out) {
+    int count = sortTopK(sel);
+    if (out != sel->heap) memcpy(out, sel->heap, (size_t)count * sizeof(ScoredRow));
+    return count;
+}
+
+#endif
@@ -0,0 +1,604 @@
+// Time-Bucketed Nutrition Totals (Meal-Log Aggregation)
+// NutriPlan - Data Structures Project
+// Every logged meal is added once to its local day's bucket and to the
+// bucket of its calendar week and month. Rolling 7/30-day totals slide
+// one day at a time as "today" moves, and the streak is kept with a
+// union-find over consecutive active days. A dashboard query reads a
+// handful of cached numbers, however many years of history there are.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "journal.h"
+
+#define SECONDS_PER_DAY 86400
+#define IST_OFFSET 19800       // UTC+5:30, the default local time
+// Timestamps are Unix seconds (time(NULL), journal records). Anything
+// outside [1970, 2100) is rejected: a millisecond Date.now() value would
+// otherwise stretch the dense day array to millions of buckets
+#define MIN_MEAL_TIME 0LL
+#define MAX_MEAL_TIME 4102444800LL   // 2100-01-01 00:00 UTC
+#define NUM_WINDOWS 2
+
+static const int windowDays[NUM_WINDOWS] = { 7, 30 };
+
+typedef struct {
+    long calories;
+    double protein;
+    double carbs;
+    long meals;
+} Totals;
+
+typedef struct {
+    Totals totals;
+    long runStart;         // days only: union-find parent, roots are the first day of a run
+    int32_t runLength;     // days only: valid at a root
+} Bucket;
+
+// Dense array of buckets for keys [base, base + count)
+typedef struct {
+    Bucket *items;
+    long base;
+    long count;
+    long capacity;
+} BucketArray;
+
+typedef struct {
+    long utcOffset;        // seconds added to a timestamp to get local time
+    BucketArray days;      // key: local day number (days since 1970-01-01)
+    BucketArray weeks;     // key: Monday-based week number
+    BucketArray months;    // key: year * 12 + month - 1
+
+    long today;
+    Totals rolling[NUM_WINDOWS];  // days (today - windowDays[w], today]
+    int currentStreak;     // consecutive active days ending today
+    int bestStreak;
+    long activeDays;
+    long meals;
+} MealStats;
+
+typedef struct {
+    Totals today;
+    Totals last7;
+    Totals last30;
+    Totals thisWeek;
+    Totals thisMonth;
+    int currentStreak;
+    int bestStreak;
+    long activeDays;
+} Dashboard;
+
+// ================= CALENDAR =================
+
+static inline long floorDiv(long a, long b) {
+    return a / b - (a % b != 0 && (a < 0) != (b < 0));
+}
+
+// Date.now() / MealEvent.ts (milliseconds) -> Unix seconds
+static inline int64_t secondsFromMillis(int64_t ms) {
+    return ms / 1000 - (ms % 1000 < 0);
+}
+
+long dayOf(const MealStats *stats, int64_t timestamp) {
+    return floorDiv((long)(timestamp + stats->utcOffset), SECONDS_PER_DAY);
+}
+
+// 1970-01-01 was a Thursday; weeks start on Monday
+long weekOf(long day) {
+    return floorDiv(day + 3, 7);
+}
+
+// Day number -> civil year/month/day (proleptic Gregorian)
+void civilFromDays(long day, int *year, int *month, int *dayOfMonth) {
+    day += 719468;
+    long era = floorDiv(day, 146097);
+    long dayOfEra = day - era * 146097;
+    long yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    long dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    long mp = (5 * dayOfYear + 2) / 153;
+    *dayOfMonth = (int)(dayOfYear - (153 * mp + 2) / 5 + 1);
+    *month = (int)(mp < 10 ? mp + 3 : mp - 9);
+    *year = (int)(yearOfEra + era * 400 + (*month <= 2));
+}
+
+long monthOf(long day) {
+    int year, month, dayOfMonth;
+    civilFromDays(day, &year, &month, &dayOfMonth);
+    return (long)year * 12 + month - 1;
+}
+
+// ================= BUCKETS =================
+
+// Bucket for key, or NULL if nothing was ever added to it
+static inline Bucket* findBucket(const BucketArray *array, long key) {
+    if (key < array->base || key >= array->base + array->count) return NULL;
+    return &array->items[key - array->base];
+}
+
+// Bucket for key, extending the array on either side (zeroed)
+// Returns NULL (after printing an error) if out of memory
+// Time Complexity: O(1) amortized
+Bucket* touchBucket(BucketArray *array, long key) {
+    if (array->count == 0) {
+        array->base = key;
+    }
+    long first = key < array->base ? key : array->base;
+    long end = array->count == 0 || key >= array->base + array->count ? key + 1 : array->base + array->count;
+    long needed = end - first;
+    if (needed > array->capacity) {
+        long newCapacity = array->capacity > 0 ? array->capacity * 2 : 64;
+        while (newCapacity < needed) newCapacity *= 2;
+        Bucket *grown = (Bucket*)realloc(array->items, newCapacity * sizeof(Bucket));
+        if (grown == NULL) {
+            printf("❌ Memory allocation failed!\n");
+            return NULL;
+        }
+        array->items = grown;
+        array->capacity = newCapacity;
+    }
+    if (first < array->base) {
+        long shift = array->base - first;
+        memmove(array->items + shift, array->items, array->count * sizeof(Bucket));
+        memset(array->items, 0, shift * sizeof(Bucket));
+        array->count += shift;
+        array->base = first;
+    }
+    if (end > array->base + array->count) {
+        memset(array->items + array->count, 0, (end - array->base - array->count) * sizeof(Bucket));
+        array->count = end - array->base;
+    }
+    return &array->items[key - array->base];
+}
+
+static inline void addTotals(Totals *into, const Totals *t) {
+    into->calories += t->calories;
+    into->protein += t->protein;
+    into->carbs += t->carbs;
+    into->meals += t->meals;
+}
+
+static inline void subtractTotals(Totals *from, const Totals *t) {
+    from->calories -= t->calories;
+    from->protein -= t->protein;
+    from->carbs -= t->carbs;
+    from->meals -= t->meals;
+}
+
+// ================= STREAKS =================
+
+// First day of the run of active days containing day (path halving)
+// Time Complexity: O(α(days)) amortized
+long runRoot(MealStats *stats, long day) {
+    Bucket *b = findBucket(&stats->days, day);
+    while (b->runStart != day) {
+        Bucket *parent = findBucket(&stats->days, b->runStart);
+        b->runStart = parent->runStart;
+        day = b->runStart;
+        b = findBucket(&stats->days, day);
+    }
+    return day;
+}
+
+static inline int isActive(const MealStats *stats, long day) {
+    const Bucket *b = findBucket(&stats->days, day);
+    return b != NULL && b->totals.meals > 0;
+}
+
+void refreshStreak(MealStats *stats) {
+    stats->currentStreak = isActive(stats, stats->today)
+                           ? (int)(stats->today - runRoot(stats, stats->today) + 1) : 0;
+}
+
+// day just got its first meal: join it to the runs on either side
+void activateDay(MealStats *stats, long day) {
+    Bucket *b = findBucket(&stats->days, day);
+    b->runStart = day;
+    b->runLength = 1;
+    stats->activeDays++;
+
+    long root = day;
+    if (isActive(stats, day - 1)) {
+        root = runRoot(stats, day - 1);
+        Bucket *left = findBucket(&stats->days, root);
+        b->runStart = root;
+        left->runLength++;
+    }
+    if (isActive(stats, day + 1)) {
+        Bucket *right = findBucket(&stats->days, day + 1);   // a root: its run starts there
+        Bucket *rootBucket = findBucket(&stats->days, root);
+        right->runStart = root;
+        rootBucket->runLength += right->runLength;
+    }
+    int length = findBucket(&stats->days, root)->runLength;
+    if (length > stats->bestStreak) stats->bestStreak = length;
+}
+
+// ================= ENGINE =================
+
+void initMealStats(MealStats *stats, long utcOffset, int64_t now) {
+    memset(stats, 0, sizeof(MealStats));
+    stats->utcOffset = utcOffset;
+    stats->today = dayOf(stats, now);
+}
+
+void freeMealStats(MealStats *stats) {
+    free(stats->days.items);
+    free(stats->weeks.items);
+    free(stats->months.items);
+    memset(stats, 0, sizeof(MealStats));
+}
+
+// Totals of one day / week / month (zero if nothing was logged)
+// Time Complexity: O(1)
+Totals dayTotals(const MealStats *stats, long day) {
+    const Bucket *b = findBucket(&stats->days, day);
+    Totals none = { 0, 0.0, 0.0, 0 };
+    return b != NULL ? b->totals : none;
+}
+
+Totals weekTotals(const MealStats *stats, long week) {
+    const Bucket *b = findBucket(&stats->weeks, week);
+    Totals none = { 0, 0.0, 0.0, 0 };
+    return b != NULL ? b->totals : none;
+}
+
+Totals monthTotals(const MealStats *stats, int year, int month) {
+    const Bucket *b = findBucket(&stats->months, (long)year * 12 + month - 1);
+    Totals none = { 0, 0.0, 0.0, 0 };
+    return b != NULL ? b->totals : none;
+}
+
+// Log one meal (in any order - late and backdated entries are fine)
+// timestamp is in Unix seconds (see secondsFromMillis for Date.now() values)
+// Returns 0 on success, -1 if the timestamp is out of range or out of memory
+// Time Complexity: O(1) amortized
+int addMeal(MealStats *stats, int64_t timestamp, int calories, double protein, double carbs) {
+    if (timestamp < MIN_MEAL_TIME || timestamp >= MAX_MEAL_TIME) {
+        printf("❌ Meal time %lld is not a Unix time in seconds, skipped\n", (long long)timestamp);
+        return -1;
+    }
+    long day = dayOf(stats, timestamp);
+    Totals meal = { calories, protein, carbs, 1 };
+
+    Bucket *week = touchBucket(&stats->weeks, weekOf(day));
+    Bucket *month = week != NULL ? touchBucket(&stats->months, monthOf(day)) : NULL;
+    Bucket *b = month != NULL ? touchBucket(&stats->days, day) : NULL;
+    if (b == NULL) return -1;
+    addTotals(&week->totals, &meal);
+    addTotals(&month->totals, &meal);
+    addTotals(&b->totals, &meal);
+    stats->meals++;
+
+    for (int w = 0; w < NUM_WINDOWS; w++) {
+        if (day <= stats->today && day > stats->today - windowDays[w]) {
+            addTotals(&stats->rolling[w], &meal);
+        }
+    }
+    if (b->totals.meals == 1) {
+        activateDay(stats, day);
+        refreshStreak(stats);
+    }
+    return 0;
+}
+
+// Move "today" to the day of now, sliding the rolling windows
+// Time Complexity: O(1) per day moved (O(30) for big jumps)
+void setNow(MealStats *stats, int64_t now) {
+    long day = dayOf(stats, now);
+    if (day == stats->today) return;
+
+    if (day > stats->today && day - stats->today <= windowDays[NUM_WINDOWS - 1]) {
+        while (stats->today < day) {
+            stats->today++;
+            for (int w = 0; w < NUM_WINDOWS; w++) {
+                Totals entering = dayTotals(stats, stats->today);
+                Totals leaving = dayTotals(stats, stats->today - windowDays[w]);
+                addTotals(&stats->rolling[w], &entering);
+                subtractTotals(&stats->rolling[w], &leaving);
+            }
+        }
+    } else {
+        // Long jump or clock moved back: rebuild from the day buckets
+        stats->today = day;
+        for (int w = 0; w < NUM_WINDOWS; w++) {
+            memset(&stats->rolling[w], 0, sizeof(Totals));
+            for (long d = day - windowDays[w] + 1; d <= day; d++) {
+                Totals t = dayTotals(stats, d);
+                addTotals(&stats->rolling[w], &t);
+            }
+        }
+    }
+    refreshStreak(stats);
+}
+
+// Everything progress.html shows
+// Time Complexity: O(1)
+void getDashboard(const MealStats *stats, Dashboard *out) {
+    out->today = dayTotals(stats, stats->today);
+    out->last7 = stats->rolling[0];
+    out->last30 = stats->rolling[1];
+    out->thisWeek = weekTotals(stats, weekOf(stats->today));
+    const Bucket *month = findBucket(&stats->months, monthOf(stats->today));
+    Totals none = { 0, 0.0, 0.0, 0 };
+    out->thisMonth = month != NULL ? month->totals : none;
+    out->currentStreak = stats->currentStreak;
+    out->bestStreak = stats->bestStreak;
+    out->activeDays = stats->activeDays;
+}
+
+// Calories for Mon..Sun of the current week (the weekly chart)
+// Time Complexity: O(7)
+void weekChart(const MealStats *stats, long calories[7]) {
+    long monday = weekOf(stats->today) * 7 - 3;
+    for (int i = 0; i < 7; i++) calories[i] = dayTotals(stats, monday + i).calories;
+}
+
+void printTotals(const char *label, const Totals *t) {
+    printf("   %-11s %6ld kcal  %7.1f g protein  %7.1f g carbs  %4ld meals\n",
+           label, t->calories, t->protein, t->carbs, t->meals);
+}
+
+void printDashboard(const MealStats *stats) {
+    Dashboard d;
+    getDashboard(stats, &d);
+    int year, month, dayOfMonth;
+    civilFromDays(stats->today, &year, &month, &dayOfMonth);
+    printf("📊 Dashboard for %04d-%02d-%02d (%ld meals over %ld active days)\n",
+           year, month, dayOfMonth, stats->meals, d.activeDays);
+    printTotals("Today", &d.today);
+    printTotals("Last 7 days", &d.last7);
+    printTotals("Last 30", &d.last30);
+    printTotals("This week", &d.thisWeek);
+    printTotals("This month", &d.thisMonth);
+    printf("   🔥 Streak: %d day(s), best %d\n", d.currentStreak, d.bestStreak);
+
+    static const char *weekdays[7] = { "Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun" };
+    long chart[7];
+    weekChart(stats, chart);
+    printf("   Week:");
+    for (int i = 0; i < 7; i++) printf(" %s %ld", weekdays[i], chart[i]);
+    printf("\n");
+}
+
+// ================= MEAL LOG FROM THE JOURNAL =================
+
+void ingestEntry(void *ctx, const JournalEntry *e) {
+    if (e->type == JR_MEAL_LOG) addMeal((MealStats*)ctx, e->time, e->calories, e->protein, e->carbs);
+}
+
+// Feed the meal log of a nutri_journal store (prefix.snapshot + the
+// journal tail of the same generation) into the engine
+// Returns the number of records read, -1 if there is no store at prefix
+long loadMealLog(MealStats *stats, const char *prefix) {
+    char path[512];
+    uint64_t generation = 0, journalGen, validSize;
+    snprintf(path, sizeof(path), "%s.snapshot", prefix);
+    long records = journalReplay(path, ingestEntry, stats, &generation, &validSize);
+    if (records < 0) {
+        records = 0;
+        generation = 0;
+    }
+    snprintf(path, sizeof(path), "%s.journal", prefix);
+    if (journalGeneration(path, &journalGen) == 0 && journalGen == generation) {
+        long tail = journalReplay(path, ingestEntry, stats, &journalGen, &validSize);
+        if (tail > 0) records += tail;
+    } else if (records == 0) {
+        return -1;
+    }
+    return records;
+}
+
+// ================= BENCHMARK =================
+
+typedef struct {
+    int64_t timestamp;
+    int calories;
+    double protein;
+    double carbs;
+} MealRecord;
+
+double elapsedMs(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+// Synthetic history: 0-5 meals a day with breaks, logged up to a day late
+MealRecord* generateHistory(int years, int64_t start, long *count) {
+    long days = years * 365L;
+    MealRecord *log = (MealRecord*)malloc(days * 5 * sizeof(MealRecord));
+    long n = 0;
+    uint32_t seed = 42;
+    for (long d = 0; d < days; d++) {
+        seed = seed * 1103515245u + 12345u;
+        int meals = (seed >> 16) % 9 < 2 ? 0 : 1 + (int)((seed >> 20) % 5);
+        for (int m = 0; m < meals; m++) {
+            seed = seed * 1103515245u + 12345u;
+            log[n].timestamp = start + d * SECONDS_PER_DAY + 7 * 3600 + m * 4 * 3600 + (seed >> 24) * 60;
+            log[n].calories = 150 + (int)((seed >> 8) % 600);
+            log[n].protein = (double)((seed >> 4) % 400) / 10.0;
+            log[n].carbs = (double)((seed >> 12) % 900) / 10.0;
+            n++;
+        }
+        // Occasionally yesterday's dinner is logged after today's breakfast
+        if (n >= 2 && (seed >> 28) == 0) {
+            MealRecord tmp = log[n - 1];
+            log[n - 1] = log[n - 2];
+            log[n - 2] = tmp;
+        }
+    }
+    *count = n;
+    return log;
+}
+
+// What progress.html does on every render: convert every entry to a
+// local date and compare, then walk back from today with includes()
+void scanDashboard(const MealRecord *log, long n, int64_t now, long utcOffset, Dashboard *out,
+                   long *uniqueDays) {
+    memset(out, 0, sizeof(Dashboard));
+    time_t nowLocal = (time_t)(now + utcOffset);
+    struct tm today;
+    gmtime_r(&nowLocal, &today);
+    long todayNumber = floorDiv((long)nowLocal, SECONDS_PER_DAY);
+
+    long numUnique = 0;
+    for (long i = 0; i < n; i++) {
+        time_t local = (time_t)(log[i].timestamp + utcOffset);
+        struct tm date;
+        gmtime_r(&local, &date);
+        long day = floorDiv((long)local, SECONDS_PER_DAY);
+        Totals meal = { log[i].calories, log[i].protein, log[i].carbs, 1 };
+        if (date.tm_year == today.tm_year && date.tm_yday == today.tm_yday) addTotals(&out->today, &meal);
+        if (day <= todayNumber && day > todayNumber - 7) addTotals(&out->last7, &meal);
+        if (day <= todayNumber && day > todayNumber - 30) addTotals(&out->last30, &meal);
+
+        int seen = 0;
+        for (long u = 0; u < numUnique && !seen; u++) seen = uniqueDays[u] == day;
+        if (!seen) uniqueDays[numUnique++] = day;
+    }
+    for (long check = todayNumber; ; check--) {
+        int found = 0;
+        for (long u = 0; u < numUnique && !found; u++) found = uniqueDays[u] == check;
+        if (!found) break;
+        out->currentStreak++;
+    }
+}
+
+// Local noon of a day, as a timestamp
+static inline int64_t noonOf(long day) {
+    return (int64_t)day * SECONDS_PER_DAY + SECONDS_PER_DAY / 2 - IST_OFFSET;
+}
+
+static inline int sameTotals(const Totals *a, const Totals *b) {
+    return a->calories == b->calories && a->meals == b->meals &&
+           a->protein - b->protein < 1e-6 && b->protein - a->protein < 1e-6 &&
+           a->carbs - b->carbs < 1e-6 && b->carbs - a->carbs < 1e-6;
+}
+
+// Replay a history day by day, checking the incremental dashboard
+// against a full scan every checkEvery days, then time repeated renders
+void benchmarkDashboard(int years, int renders, int checkEvery) {
+    printf("=== BENCHMARK: %d years of meal history, %d dashboard renders ===\n", years, renders);
+    int64_t start = 1577817000;  // 2020-01-01 00:00 IST
+    long n;
+    MealRecord *log = generateHistory(years, start, &n);
+    long *uniqueDays = (long*)malloc(years * 366L * sizeof(long));
+    printf("%ld meals logged\n", n);
+
+    // Ingest in log order, moving the clock forward like a real user
+    MealStats stats;
+    initMealStats(&stats, IST_OFFSET, start);
+    int same = 1;
+    long checks = 0;
+    clock_t checkTicks = 0;
+    clock_t t = clock();
+    for (long i = 0; i < n; i++) {
+        if (log[i].timestamp > (int64_t)(stats.today + 1) * SECONDS_PER_DAY - IST_OFFSET) {
+            setNow(&stats, log[i].timestamp);
+        }
+        addMeal(&stats, log[i].timestamp, log[i].calories, log[i].protein, log[i].carbs);
+        if (i + 1 < n && dayOf(&stats, log[i + 1].timestamp) != stats.today &&
+            stats.today % checkEvery == 0) {
+            clock_t checkStart = clock();
+            Dashboard fast, slow;
+            getDashboard(&stats, &fast);
+            scanDashboard(log, i + 1, noonOf(stats.today), IST_OFFSET, &slow, uniqueDays);
+            same &= sameTotals(&fast.today, &slow.today) && sameTotals(&fast.last7, &slow.last7) &&
+                    sameTotals(&fast.last30, &slow.last30) && fast.currentStreak == slow.currentStreak;
+            checks++;
+            checkTicks += clock() - checkStart;
+        }
+    }
+    double ingestMs = elapsedMs(t) - (double)checkTicks * 1000.0 / CLOCKS_PER_SEC;
+    printf("Incremental ingest    : %8.2f ms (checked against a full scan on %ld days)\n",
+           ingestMs, checks);
+
+    int64_t now = noonOf(stats.today);
+    Dashboard fast, slow;
+    memset(&fast, 0, sizeof(fast));
+    t = clock();
+    for (int r = 0; r < renders; r++) scanDashboard(log, n, now, IST_OFFSET, &slow, uniqueDays);
+    double scanMs = elapsedMs(t);
+
+    volatile long sink = 0;
+    t = clock();
+    for (int r = 0; r < renders; r++) {
+        getDashboard(&stats, &fast);
+        sink += fast.today.calories;
+    }
+    double fastMs = elapsedMs(t);
+    (void)sink;
+    same &= sameTotals(&fast.today, &slow.today) && sameTotals(&fast.last7, &slow.last7) &&
+            sameTotals(&fast.last30, &slow.last30) && fast.currentStreak == slow.currentStreak;
+
+    printf("Scan per render       : %8.2f ms (%.1f µs per render)\n", scanMs, scanMs * 1000.0 / renders);
+    printf("Bucketed per render   : %8.2f ms (%.3f µs per render)\n", fastMs, fastMs * 1000.0 / renders);
+    printf("Speedup: %.0fx\n", fastMs > 0 ? scanMs / fastMs : 0.0);
+    printf("Same dashboards: %s\n\n", same ? "Yes" : "No");
+
+    printDashboard(&stats);
+    printf("\n");
+    freeMealStats(&stats);
+    free(uniqueDays);
+    free(log);
+}
+
+// ================= TIMESTAMP UNITS =================
+
+// A millisecond timestamp (what meals.html and meal_queue.c carry) must be
+// refused, not turned into a day 50,000 years out; converted, it lands on
+// the right day
+int timestampUnitTest(void) {
+    MealStats stats;
+    int64_t nowMs = 1700000000000LL + 12345;
+    initMealStats(&stats, IST_OFFSET, secondsFromMillis(nowMs));
+    int ok = 1;
+
+    if (addMeal(&stats, nowMs, 300, 20.0, 30.0) == 0 || stats.days.count != 0 || stats.meals != 0) {
+        printf("❌ Millisecond timestamp was accepted (%ld day buckets)\n", stats.days.count);
+        ok = 0;
+    }
+    if (addMeal(&stats, secondsFromMillis(nowMs), 300, 20.0, 30.0) != 0 ||
+        dayTotals(&stats, stats.today).calories != 300 || stats.days.count != 1) {
+        printf("❌ Converted timestamp did not land on today\n");
+        ok = 0;
+    }
+    if (secondsFromMillis(-1) != -1) {
+        printf("❌ secondsFromMillis does not round down\n");
+        ok = 0;
+    }
+    printf("%s Timestamps outside seconds range rejected\n\n", ok ? "✅" : "❌");
+    freeMealStats(&stats);
+    return ok;
+}
+
+// Build: gcc -O2 meal_stats.c
+// Usage: meal_stats [store prefix]   (e.g. ./nutriplan from nutri_journal)
+int main(int argc, char **argv) {
+    const char *prefix = argc > 1 ? argv[1] : "nutriplan";
+
+    printf("\n=== NutriPlan Nutrition Totals (Time-Bucketed Aggregation) ===\n\n");
+
+    MealStats stats;
+    initMealStats(&stats, IST_OFFSET, (int64_t)time(NULL));
+    long records = loadMealLog(&stats, prefix);
+    if (records < 0) {
+        printf("No meal log at %s.* (run nutri_journal first) - showing sample data\n", prefix);
+        int64_t now = (int64_t)time(NULL);
+        addMeal(&stats, now - 2 * SECONDS_PER_DAY, 420, 18.0, 55.0);
+        addMeal(&stats, now - SECONDS_PER_DAY, 250, 6.0, 40.0);
+        addMeal(&stats, now - SECONDS_PER_DAY, 320, 14.0, 48.0);
+        addMeal(&stats, now, 300, 22.0, 12.0);
+    } else {
+        printf("Read %ld records from %s.*\n", records, prefix);
+    }
+    printDashboard(&stats);
+    freeMealStats(&stats);
+    printf("\n");
+
+    int ok = timestampUnitTest();
+    benchmarkDashboard(5, 200, 7);
+
+    printf("=== Dashboards in constant time, whatever the history ===\n\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,678 @@
+// Persistent Sin Stack and Meal Log (Write-Ahead Journal)
+// NutriPlan - Data Structures Project
+// Every push, pop, clear and meal log is appended to a journal as one
+// small record before it is applied in memory, so a change costs O(1)
+// bytes however long the history is. Once the journal holds enough
+// records it is compacted into a snapshot. Recovery loads the snapshot
+// and replays the journal tail written after it.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <signal.h>
+#include <time.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "string_pool.h"
+#include "journal.h"
+
+#define PATH_SIZE 512
+
+// One cheat meal on the sin stack
+typedef struct {
+    StringId name;
+    StringId icon;
+    int32_t calories;
+    int64_t eatenAt;
+} Sin;
+
+// One logged meal
+typedef struct {
+    StringId name;
+    int32_t calories;
+    float protein;
+    float carbs;
+    int64_t loggedAt;
+} LoggedMeal;
+
+// In-memory state rebuilt from snapshot + journal
+typedef struct {
+    StringPool names;
+    Sin *sins;
+    long numSins;
+    long sinCapacity;
+    long sinCalories;      // running total of the stack
+    LoggedMeal *meals;
+    long numMeals;
+    long mealCapacity;
+} NutriState;
+
+typedef struct {
+    NutriState state;
+    Journal journal;
+    char journalPath[PATH_SIZE];
+    char snapshotPath[PATH_SIZE];
+    uint64_t generation;   // of the current snapshot and journal
+    long journalRecords;   // records in the journal, replayed + appended
+    long compactAfter;     // compact once the journal holds this many records (0 = never)
+    SyncPolicy policy;
+    int batchSize;
+    long snapshotRecords;  // replayed on the last open
+    long replayedRecords;
+    long failedCompactions;  // compactions that failed after their op was committed
+} NutriStore;
+
+// ================= IN-MEMORY STATE =================
+
+int initState(NutriState *state) {
+    memset(state, 0, sizeof(NutriState));
+    return initStringPool(&state->names);
+}
+
+void freeState(NutriState *state) {
+    freeStringPool(&state->names);
+    free(state->sins);
+    free(state->meals);
+    memset(state, 0, sizeof(NutriState));
+}
+
+// Make room for one more element of a growable array
+// Returns 0 on success, -1 if out of memory
+int reserveOne(void **items, long count, long *capacity, size_t size) {
+    if (count < *capacity) return 0;
+    long newCapacity = *capacity > 0 ? *capacity * 2 : 64;
+    void *grown = realloc(*items, newCapacity * size);
+    if (grown == NULL) {
+        printf("❌ Memory allocation failed!\n");
+        return -1;
+    }
+    *items = grown;
+    *capacity = newCapacity;
+    return 0;
+}
+
+// Apply one journal record to the state (replay callback)
+// Time Complexity: O(1) amortized
+void applyEntry(void *ctx, const JournalEntry *e) {
+    NutriState *state = (NutriState*)ctx;
+    switch (e->type) {
+        case JR_SIN_PUSH:
+            if (reserveOne((void**)&state->sins, state->numSins, &state->sinCapacity, sizeof(Sin)) != 0) return;
+            state->sins[state->numSins].name = internString(&state->names, e->name);
+            state->sins[state->numSins].icon = internString(&state->names, e->icon);
+            state->sins[state->numSins].calories = e->calories;
+            state->sins[state->numSins].eatenAt = e->time;
+            state->numSins++;
+            state->sinCalories += e->calories;
+            break;
+        case JR_SIN_POP:
+            if (state->numSins > 0) state->sinCalories -= state->sins[--state->numSins].calories;
+            break;
+        case JR_SIN_CLEAR:
+            state->numSins = 0;
+            state->sinCalories = 0;
+            break;
+        case JR_MEAL_LOG:
+            if (reserveOne((void**)&state->meals, state->numMeals, &state->mealCapacity, sizeof(LoggedMeal)) != 0) return;
+            state->meals[state->numMeals].name = internString(&state->names, e->name);
+            state->meals[state->numMeals].calories = e->calories;
+            state->meals[state->numMeals].protein = e->protein;
+            state->meals[state->numMeals].carbs = e->carbs;
+            state->meals[state->numMeals].loggedAt = e->time;
+            state->numMeals++;
+            break;
+    }
+}
+
+// Same sins and meals, in the same order?
+int sameState(const NutriState *a, const NutriState *b) {
+    if (a->numSins != b->numSins || a->numMeals != b->numMeals || a->sinCalories != b->sinCalories) {
+        return 0;
+    }
+    for (long i = 0; i < a->numSins; i++) {
+        const Sin *x = &a->sins[i], *y = &b->sins[i];
+        if (x->calories != y->calories || x->eatenAt != y->eatenAt ||
+            strcmp(poolString(&a->names, x->name), poolString(&b->names, y->name)) != 0 ||
+            strcmp(poolString(&a->names, x->icon), poolString(&b->names, y->icon)) != 0) return 0;
+    }
+    for (long i = 0; i < a->numMeals; i++) {
+        const LoggedMeal *x = &a->meals[i], *y = &b->meals[i];
+        if (x->calories != y->calories || x->loggedAt != y->loggedAt ||
+            x->protein != y->protein || x->carbs != y->carbs ||
+            strcmp(poolString(&a->names, x->name), poolString(&b->names, y->name)) != 0) return 0;
+    }
+    return 1;
+}
+
+// ================= STORE =================
+
+// Write the current state as snapshot generation + 1 (tmp file, fsync,
+// rename). The journal is untouched, so a crash here loses nothing
+// Returns 0 on success, -1 on error
+// Time Complexity: O(state size)
+int writeSnapshot(NutriStore *store) {
+    char tmpPath[PATH_SIZE + 8];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", store->snapshotPath);
+    Journal snapshot;
+    if (journalCreate(&snapshot, tmpPath, store->generation + 1, SYNC_NONE, 1) != 0) return -1;
+
+    NutriState *state = &store->state;
+    int failed = 0;
+    for (long i = 0; i < state->numSins && !failed; i++) {
+        const Sin *sin = &state->sins[i];
+        failed = journalAppendSin(&snapshot, sin->eatenAt, sin->calories,
+                                  poolString(&state->names, sin->name),
+                                  poolString(&state->names, sin->icon)) != 0;
+    }
+    for (long i = 0; i < state->numMeals && !failed; i++) {
+        const LoggedMeal *meal = &state->meals[i];
+        failed = journalAppendMeal(&snapshot, meal->loggedAt, meal->calories, meal->protein,
+                                   meal->carbs, poolString(&state->names, meal->name)) != 0;
+    }
+    if (failed) {
+        close(snapshot.fd);
+        unlink(tmpPath);
+        return -1;
+    }
+    return journalCommit(&snapshot, tmpPath, store->snapshotPath);
+}
+
+// Compact: snapshot the state, then start an empty journal for the new
+// generation. A crash between the two steps leaves a journal of the old
+// generation, which recovery ignores (its records are in the snapshot)
+// Returns 0 on success, -1 on error
+int compactStore(NutriStore *store) {
+    if (writeSnapshot(store) != 0) return -1;
+    store->generation++;
+    journalClose(&store->journal);
+    if (journalCreate(&store->journal, store->journalPath, store->generation,
+                      store->policy, store->batchSize) != 0) return -1;
+    store->journalRecords = 0;
+    return 0;
+}
+
+// Size of the file at path, -1 if it does not exist; any other stat
+// error is reported as a huge size so callers never treat it as missing
+static inline int64_t fileSizeOf(const char *path) {
+    struct stat st;
+    if (stat(path, &st) == 0) return (int64_t)st.st_size;
+    return errno == ENOENT ? -1 : INT64_MAX;
+}
+
+// Give up on an open: drop whatever a replay applied and leave both
+// files untouched
+static inline int failOpen(NutriStore *store, const char *why, const char *path) {
+    printf("❌ Cannot open store: %s (%s)\n", why, path);
+    freeState(&store->state);
+    initState(&store->state);
+    return -1;
+}
+
+// Open (or create) the store at prefix.snapshot / prefix.journal and
+// recover its state. Only a missing snapshot means generation 0; a
+// snapshot that exists but does not replay in full, or a journal ahead of
+// the snapshot, fails the open so the journal is never recreated over
+// acknowledged records
+// Returns 0 on success, -1 on error (message printed)
+// Time Complexity: O(snapshot + journal size)
+int openStore(NutriStore *store, const char *prefix, SyncPolicy policy, int batchSize,
+              long compactAfter) {
+    memset(store, 0, sizeof(NutriStore));
+    store->journal.fd = -1;
+    snprintf(store->journalPath, PATH_SIZE, "%s.journal", prefix);
+    snprintf(store->snapshotPath, PATH_SIZE, "%s.snapshot", prefix);
+    store->policy = policy;
+    store->batchSize = batchSize;
+    store->compactAfter = compactAfter;
+    if (initState(&store->state) != 0) return -1;
+
+    // Snapshot (generation 0 = no snapshot yet). Snapshots are committed
+    // by rename, so one that replays only partly is corrupt
+    uint64_t validSize = 0;
+    int64_t snapshotSize = fileSizeOf(store->snapshotPath);
+    if (snapshotSize >= 0) {
+        store->snapshotRecords = journalReplay(store->snapshotPath, applyEntry, &store->state,
+                                               &store->generation, &validSize);
+        if (store->snapshotRecords < 0 || (int64_t)validSize != snapshotSize) {
+            return failOpen(store, "snapshot unreadable or corrupt", store->snapshotPath);
+        }
+    }
+
+    // Journal tail, only if it belongs to this snapshot. An older journal
+    // is left over from an interrupted compaction (its records are in the
+    // snapshot); a journal that only holds a torn header was never written to
+    uint64_t journalGen;
+    int64_t journalSize = fileSizeOf(store->journalPath);
+    if (journalSize > (int64_t)sizeof(JournalHeader)) {
+        if (journalGeneration(store->journalPath, &journalGen) != 0) {
+            return failOpen(store, "journal unreadable", store->journalPath);
+        }
+        if (journalGen > store->generation) {
+            return failOpen(store, "journal is ahead of the snapshot", store->journalPath);
+        }
+        if (journalGen == store->generation) {
+            store->replayedRecords = journalReplay(store->journalPath, applyEntry, &store->state,
+                                                   &journalGen, &validSize);
+            if (store->replayedRecords < 0) return failOpen(store, "journal unreadable", store->journalPath);
+            store->journalRecords = store->replayedRecords;
+            return journalReopen(&store->journal, store->journalPath, store->generation,
+                                 validSize, policy, batchSize);
+        }
+    }
+    return journalCreate(&store->journal, store->journalPath, store->generation, policy, batchSize);
+}
+
+void closeStore(NutriStore *store) {
+    journalClose(&store->journal);
+    freeState(&store->state);
+}
+
+// Compact if the journal has grown past the threshold. The op itself is
+// already durable and applied, so a failed compaction is counted in
+// failedCompactions (and retried on the next append), not returned
+static inline int afterAppend(NutriStore *store) {
+    store->journalRecords++;
+    if (store->compactAfter > 0 && store->journalRecords >= store->compactAfter &&
+        compactStore(store) != 0) {
+        store->failedCompactions++;
+        printf("⚠️  Compaction failed; the change is committed, the journal keeps growing\n");
+    }
+    return 0;
+}
+
+// Log first, then apply: a change is visible only once it is journaled
+// Each returns 0 on success, -1 on error
+// Time Complexity: O(1) amortized (plus the occasional compaction)
+int storePushSin(NutriStore *store, const char *name, const char *icon, int calories, int64_t eatenAt) {
+    JournalEntry e;
+    memset(&e, 0, sizeof(e));
+    e.type = JR_SIN_PUSH;
+    e.time = eatenAt;
+    e.calories = calories;
+    snprintf(e.name, sizeof(e.name), "%s", name);
+    snprintf(e.icon, sizeof(e.icon), "%s", icon);
+    if (journalAppendSin(&store->journal, eatenAt, calories, e.name, e.icon) != 0) return -1;
+    applyEntry(&store->state, &e);
+    return afterAppend(store);
+}
+
+int storePopSin(NutriStore *store) {
+    if (store->state.numSins == 0) return -1;
+    JournalEntry e = { .type = JR_SIN_POP };
+    if (journalAppend(&store->journal, JR_SIN_POP, NULL, 0) != 0) return -1;
+    applyEntry(&store->state, &e);
+    return afterAppend(store);
+}
+
+int storeClearSins(NutriStore *store) {
+    JournalEntry e = { .type = JR_SIN_CLEAR };
+    if (journalAppend(&store->journal, JR_SIN_CLEAR, NULL, 0) != 0) return -1;
+    applyEntry(&store->state, &e);
+    return afterAppend(store);
+}
+
+int storeLogMeal(NutriStore *store, const char *name, int calories, float protein, float carbs,
+                 int64_t loggedAt) {
+    JournalEntry e;
+    memset(&e, 0, sizeof(e));
+    e.type = JR_MEAL_LOG;
+    e.time = loggedAt;
+    e.calories = calories;
+    e.protein = protein;
+    e.carbs = carbs;
+    snprintf(e.name, sizeof(e.name), "%s", name);
+    if (journalAppendMeal(&store->journal, loggedAt, calories, protein, carbs, e.name) != 0) return -1;
+    applyEntry(&store->state, &e);
+    return afterAppend(store);
+}
+
+void printStore(NutriStore *store) {
+    NutriState *state = &store->state;
+    printf("📚 %ld sins on the stack (%ld kcal) | 🍽  %ld meals logged | generation %llu, "
+           "%ld journal records\n", state->numSins, state->sinCalories, state->numMeals,
+           (unsigned long long)store->generation, store->journalRecords);
+    if (state->numSins > 0) {
+        const Sin *top = &state->sins[state->numSins - 1];
+        printf("   Top sin: %s %s (%d kcal)\n", poolString(&state->names, top->icon),
+               poolString(&state->names, top->name), top->calories);
+    }
+}
+
+// ================= CRASH-RECOVERY TEST =================
+
+// Deterministic operation i of a mixed workload
+typedef struct {
+    int kind;              // JR_* type
+    const char *name;
+    const char *icon;
+    int calories;
+    float protein;
+    float carbs;
+    int64_t time;
+} Operation;
+
+Operation makeOperation(long i) {
+    static const char *junk[] = { "Pizza", "Burger with Fries", "Maggi", "Cola", "Samosa" };
+    static const char *icons[] = { "🍕", "🍔", "🍜", "🥤", "🥟" };
+    static const char *meals[] = { "Poha", "Dal Tadka", "Paneer Bhurji", "Oats Upma", "Egg Curry" };
+    Operation op;
+    uint32_t r = (uint32_t)(i * 2654435761u) >> 8;
+    op.time = 1700000000 + i * 600;
+    op.calories = 100 + (int)(r % 600);
+    op.protein = (float)(r % 40);
+    op.carbs = (float)(r % 70);
+    op.name = meals[r % 5];
+    op.icon = "";
+    switch (r % 100 / 5) {
+        case 0: case 1: case 2: case 3: case 4:
+            op.kind = JR_SIN_PUSH;
+            op.name = junk[r % 5];
+            op.icon = icons[r % 5];
+            break;
+        case 5: case 6:
+            op.kind = JR_SIN_POP;
+            break;
+        case 7:
+            op.kind = r % 4 == 0 ? JR_SIN_CLEAR : JR_SIN_POP;
+            break;
+        default:
+            op.kind = JR_MEAL_LOG;
+    }
+    return op;
+}
+
+int runOperation(NutriStore *store, Operation op) {
+    switch (op.kind) {
+        case JR_SIN_PUSH: return storePushSin(store, op.name, op.icon, op.calories, op.time);
+        case JR_SIN_POP: return store->state.numSins > 0 ? storePopSin(store) : 0;
+        case JR_SIN_CLEAR: return storeClearSins(store);
+        default: return storeLogMeal(store, op.name, op.calories, op.protein, op.carbs, op.time);
+    }
+}
+
+// Expected state after operations [0, count)
+void modelState(NutriState *model, long count) {
+    initState(model);
+    for (long i = 0; i < count; i++) {
+        Operation op = makeOperation(i);
+        JournalEntry e;
+        memset(&e, 0, sizeof(e));
+        e.type = op.kind;
+        e.time = op.time;
+        e.calories = op.calories;
+        e.protein = op.protein;
+        e.carbs = op.carbs;
+        snprintf(e.name, sizeof(e.name), "%s", op.name);
+        snprintf(e.icon, sizeof(e.icon), "%s", op.icon);
+        applyEntry(model, &e);
+    }
+}
+
+void removeStoreFiles(const char *prefix) {
+    char path[PATH_SIZE + 16];
+    snprintf(path, sizeof(path), "%s.journal", prefix);
+    unlink(path);
+    snprintf(path, sizeof(path), "%s.snapshot", prefix);
+    unlink(path);
+    snprintf(path, sizeof(path), "%s.snapshot.tmp", prefix);
+    unlink(path);
+}
+
+int reportCheck(const char *label, int ok) {
+    printf("%s %s\n", ok ? "✅" : "❌", label);
+    return ok;
+}
+
+// 1. A child process runs `ops` operations and is SIGKILLed mid-stream
+// 2. A torn half-record is appended to the journal
+// 3. A compaction is interrupted after the snapshot but before the
+//    journal is reset
+// After each, the recovered state must equal the model. Then over-long
+// strings and a failed write must not cost any acknowledged record
+// Returns 1 if every check passes
+int crashRecoveryTest(const char *prefix, long ops) {
+    printf("=== CRASH-RECOVERY TEST (%ld operations, %s.*) ===\n", ops, prefix);
+    removeStoreFiles(prefix);
+    int ok = 1;
+
+    pid_t child = fork();
+    if (child == 0) {
+        NutriStore store;
+        if (openStore(&store, prefix, SYNC_BATCH, 32, 400) != 0) _exit(1);
+        for (long i = 0; i < ops; i++) {
+            if (runOperation(&store, makeOperation(i)) != 0) _exit(1);
+        }
+        kill(getpid(), SIGKILL);  // no close, no final fsync
+        _exit(1);
+    }
+    int status = 0;
+    waitpid(child, &status, 0);
+    ok &= reportCheck("writer was killed by SIGKILL", WIFSIGNALED(status) && WTERMSIG(status) == SIGKILL);
+
+    NutriState model;
+    modelState(&model, ops);
+    NutriStore store;
+    ok &= reportCheck("store reopens after the crash", openStore(&store, prefix, SYNC_BATCH, 32, 0) == 0);
+    printf("   recovered %ld snapshot + %ld journal records\n", store.snapshotRecords, store.replayedRecords);
+    ok &= reportCheck("recovered state matches every acknowledged operation", sameState(&store.state, &model));
+    closeStore(&store);
+
+    // Torn tail: a record header promising 40 bytes followed by only 10
+    FILE *fp = fopen(store.journalPath, "ab");
+    RecordHeader torn = { 40, 0xDEADBEEF, JR_MEAL_LOG, { 0, 0, 0 } };
+    fwrite(&torn, sizeof(torn), 1, fp);
+    fwrite("0123456789", 10, 1, fp);
+    fclose(fp);
+    openStore(&store, prefix, SYNC_BATCH, 32, 0);
+    ok &= reportCheck("torn tail record is discarded", sameState(&store.state, &model));
+    Operation next = makeOperation(ops);
+    runOperation(&store, next);
+    closeStore(&store);
+    freeState(&model);
+    modelState(&model, ops + 1);
+    openStore(&store, prefix, SYNC_BATCH, 32, 0);
+    ok &= reportCheck("appends after the cut replay cleanly", sameState(&store.state, &model));
+
+    // Crash between snapshot rename and journal reset
+    writeSnapshot(&store);
+    journalClose(&store.journal);  // "crash": old-generation journal left in place
+    freeState(&store.state);
+    openStore(&store, prefix, SYNC_BATCH, 32, 0);
+    ok &= reportCheck("interrupted compaction does not replay records twice", sameState(&store.state, &model));
+    closeStore(&store);
+    freeState(&model);
+
+    // Over-long name and icon: cut to the limit replay accepts, so the
+    // record and everything after it survive a reopen
+    removeStoreFiles(prefix);
+    char longName[300 + 1], longIcon[4 * 100 + 1];
+    memset(longName, 'N', 300);
+    longName[300] = '\0';
+    for (int i = 0; i < 100; i++) memcpy(longIcon + 4 * i, "🍕", 4);
+    longIcon[400] = '\0';
+    openStore(&store, prefix, SYNC_BATCH, 32, 0);
+    storePushSin(&store, longName, longIcon, 900, 1700000000);
+    storeLogMeal(&store, "Poha", 250, 6.0f, 40.0f, 1700000100);
+    closeStore(&store);
+    openStore(&store, prefix, SYNC_BATCH, 32, 0);
+    ok &= reportCheck("long sin name and icon round-trip through reopen",
+                      store.replayedRecords == 2 && store.state.numSins == 1 && store.state.numMeals == 1 &&
+                      strlen(poolString(&store.state.names, store.state.sins[0].name)) == JOURNAL_MAX_NAME &&
+                      strlen(poolString(&store.state.names, store.state.sins[0].icon)) == JOURNAL_MAX_NAME);
+
+    // A write that fails and cannot be cut back poisons the handle: the
+    // journal is swapped for a read-only descriptor, so both write() and
+    // ftruncate() fail
+    int readOnly = open(store.journalPath, O_RDONLY);
+    dup2(readOnly, store.journal.fd);
+    close(readOnly);
+    int firstFails = storeLogMeal(&store, "Dal Tadka", 320, 14.0f, 48.0f, 1700000200) != 0;
+    int laterRefused = store.journal.failed && storeLogMeal(&store, "Oats Upma", 280, 9.0f, 45.0f, 1700000300) != 0;
+    closeStore(&store);
+    openStore(&store, prefix, SYNC_BATCH, 32, 0);
+    ok &= reportCheck("failed append is reported and later appends are refused",
+                      firstFails && laterRefused && store.state.numMeals == 1);
+    closeStore(&store);
+
+    // A snapshot that exists but cannot be replayed must not cost the
+    // journal written after it: the open fails and leaves both files alone
+    removeStoreFiles(prefix);
+    openStore(&store, prefix, SYNC_BATCH, 32, 2);
+    storeLogMeal(&store, "Poha", 250, 6.0f, 40.0f, 1700000000);
+    storeLogMeal(&store, "Idli", 280, 10.0f, 48.0f, 1700000100);  // compacts to generation 1
+    storeLogMeal(&store, "Dal Tadka", 320, 14.0f, 48.0f, 1700000200);
+    closeStore(&store);
+    int64_t journalBefore = fileSizeOf(store.journalPath);
+    truncate(store.snapshotPath, 10);
+    int refused = openStore(&store, prefix, SYNC_BATCH, 32, 0) != 0;
+    ok &= reportCheck("corrupt snapshot fails the open and keeps the journal",
+                      refused && store.state.numMeals == 0 && fileSizeOf(store.journalPath) == journalBefore);
+    closeStore(&store);
+    unlink(store.snapshotPath);
+    refused = openStore(&store, prefix, SYNC_BATCH, 32, 0) != 0;
+    ok &= reportCheck("journal ahead of a missing snapshot is not recreated",
+                      refused && fileSizeOf(store.journalPath) == journalBefore);
+    closeStore(&store);
+
+    // A compaction that fails after the op is durable still reports the op
+    // as committed: a directory squats on the snapshot's temp path
+    removeStoreFiles(prefix);
+    char squat[PATH_SIZE + 8];
+    snprintf(squat, sizeof(squat), "%s.snapshot.tmp", prefix);
+    mkdir(squat, 0700);
+    openStore(&store, prefix, SYNC_BATCH, 32, 1);
+    int committed = storeLogMeal(&store, "Poha", 250, 6.0f, 40.0f, 1700000000) == 0;
+    long failedCompactions = store.failedCompactions;
+    closeStore(&store);
+    rmdir(squat);
+    openStore(&store, prefix, SYNC_BATCH, 32, 0);
+    ok &= reportCheck("failed compaction does not fail a committed op",
+                      committed && failedCompactions == 1 && store.state.numMeals == 1);
+    closeStore(&store);
+
+    removeStoreFiles(prefix);
+    printf("\n");
+    return ok;
+}
+
+// ================= BENCHMARK =================
+
+double elapsedMs(struct timespec start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start.tv_sec) * 1000.0 + (now.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+// Re-serialize the whole history after every change (what the pages do
+// with localStorage) vs one journal record per change
+void benchmarkPersistence(const char *prefix, long ops) {
+    printf("=== BENCHMARK: persist %ld changes ===\n", ops);
+    struct timespec start;
+    char path[PATH_SIZE + 16];
+    snprintf(path, sizeof(path), "%s.rewrite", prefix);
+
+    // Full rewrite per change
+    NutriState state;
+    initState(&state);
+    uint64_t rewriteBytes = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (long i = 0; i < ops; i++) {
+        Operation op = makeOperation(i);
+        JournalEntry e;
+        memset(&e, 0, sizeof(e));
+        e.type = op.kind;
+        e.time = op.time;
+        e.calories = op.calories;
+        snprintf(e.name, sizeof(e.name), "%s", op.name);
+        snprintf(e.icon, sizeof(e.icon), "%s", op.icon);
+        applyEntry(&state, &e);
+
+        Journal all;
+        journalCreate(&all, path, 0, SYNC_NONE, 1);
+        for (long s = 0; s < state.numSins; s++) {
+            journalAppendSin(&all, state.sins[s].eatenAt, state.sins[s].calories,
+                             poolString(&state.names, state.sins[s].name),
+                             poolString(&state.names, state.sins[s].icon));
+        }
+        for (long m = 0; m < state.numMeals; m++) {
+            journalAppendMeal(&all, state.meals[m].loggedAt, state.meals[m].calories,
+                              state.meals[m].protein, state.meals[m].carbs,
+                              poolString(&state.names, state.meals[m].name));
+        }
+        rewriteBytes += all.size;
+        journalClose(&all);
+    }
+    double rewriteMs = elapsedMs(start);
+    freeState(&state);
+    unlink(path);
+    printf("rewrite everything    : %9.1f ms, %8.1f KB written per change\n",
+           rewriteMs, rewriteBytes / 1024.0 / ops);
+
+    // Journal with each sync policy (fsync is slow on real disks, so the
+    // durable policies run fewer changes)
+    SyncPolicy policies[] = { SYNC_NONE, SYNC_BATCH, SYNC_ALWAYS };
+    const char *labels[] = { "journal, no fsync", "journal, fsync/64", "journal, fsync each" };
+    long counts[] = { ops * 20, ops, ops / 10 };
+    for (int p = 0; p < 3; p++) {
+        removeStoreFiles(prefix);
+        NutriStore store;
+        openStore(&store, prefix, policies[p], 64, 0);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (long i = 0; i < counts[p]; i++) runOperation(&store, makeOperation(i));
+        double ms = elapsedMs(start);
+        uint64_t bytes = store.journal.size;
+        long records = store.journalRecords;
+        uint64_t syncs = store.journal.syncs;
+        closeStore(&store);
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        openStore(&store, prefix, SYNC_NONE, 1, 0);
+        double recoverMs = elapsedMs(start);
+        closeStore(&store);
+        printf("%-22s: %9.1f ms for %6ld changes (%5.2f µs each, %4.1f B/record, %llu fsyncs), "
+               "recovery %.1f ms\n", labels[p], ms, counts[p], ms * 1000.0 / counts[p],
+               records > 0 ? (double)(bytes - sizeof(JournalHeader)) / records : 0.0,
+               (unsigned long long)syncs, recoverMs);
+    }
+    removeStoreFiles(prefix);
+    printf("\n");
+}
+
+// Build: gcc -O2 nutri_journal.c
+// Usage: nutri_journal [directory]
+int main(int argc, char **argv) {
+    const char *dir = argc > 1 ? argv[1] : ".";
+    char prefix[PATH_SIZE];
+
+    printf("\n=== NutriPlan Persistent Sin Stack and Meal Log (Journal) ===\n\n");
+
+    // State survives between runs of this program
+    snprintf(prefix, sizeof(prefix), "%s/nutriplan", dir);
+    NutriStore store;
+    if (openStore(&store, prefix, SYNC_BATCH, 16, 1000) != 0) return 1;
+    printf("--- RECOVERED FROM %s.* ---\n", prefix);
+    printStore(&store);
+
+    int64_t now = (int64_t)time(NULL);
+    printf("\n--- TODAY ---\n");
+    storeLogMeal(&store, "Poha", 250, 6.0, 40.0, now);
+    storeLogMeal(&store, "Dal Tadka", 320, 14.0, 48.0, now);
+    storePushSin(&store, "Pizza", "🍕", 700, now);
+    storePushSin(&store, "Cola", "🥤", 150, now);
+    storePopSin(&store);  // regret the cola
+    printStore(&store);
+    closeStore(&store);
+    printf("(run again: the history keeps growing, one record per change)\n\n");
+
+    snprintf(prefix, sizeof(prefix), "%s/crashtest", dir);
+    int passed = crashRecoveryTest(prefix, 2500);
+
+    snprintf(prefix, sizeof(prefix), "%s/journalbench", dir);
+    benchmarkPersistence(prefix, 2000);
+
+    printf("=== Journal demonstration complete (%s) ===\n\n", passed ? "all recovery checks passed" : "RECOVERY FAILED");
+    return passed ? 0 : 1;
+}
@@ -5,13 +5,20 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "string_pool.h"
+#include "meal_scoring.h"   // scoring rules and top-K selector shared with the other rankers
 
 #define MAX_SIZE 100
 
+// Meal names, interned once; heap swaps move ids instead of strings
+StringPool mealNames;
+
 // Meal structure with nutrition score
 typedef struct {
-    char name[50];
-    char hindiName[50];
+    StringId name;
+    StringId hindiName;
     int calories;
     float protein;
     float carbs;
@@ -85,8 +92,8 @@ void insertMeal(PriorityQueue *pq, char *name, char *hindiName, int calories,
     }
     
     Meal newMeal;
-    strcpy(newMeal.name, name);
-    strcpy(newMeal.hindiName, hindiName);
+    newMeal.name = internString(&mealNames, name);
+    newMeal.hindiName = internString(&mealNames, hindiName);
     newMeal.calories = calories;
     newMeal.protein = protein;
     newMeal.carbs = carbs;
@@ -103,7 +110,7 @@ void insertMeal(PriorityQueue *pq, char *name, char *hindiName, int calories,
 // Time Complexity: O(log n)
 // Space Complexity: O(1)
 Meal extractMax(PriorityQueue *pq) {
-    Meal empty = {"", "", 0, 0, 0, 0, 0, 0};
+    Meal empty = {EMPTY_STRING, EMPTY_STRING, 0, 0, 0, 0, 0, 0};
     
     if (pq->size == 0) {
         printf("Queue is empty!\n");
@@ -120,7 +127,7 @@ Meal extractMax(PriorityQueue *pq) {
 
 // Peek at top meal without removing
 Meal peekMax(PriorityQueue *pq) {
-    Meal empty = {"", "", 0, 0, 0, 0, 0, 0};
+    Meal empty = {EMPTY_STRING, EMPTY_STRING, 0, 0, 0, 0, 0, 0};
     
     if (pq->size == 0) {
         return empty;
@@ -129,35 +136,135 @@ Meal peekMax(PriorityQueue *pq) {
     return pq->heap[0];
 }
 
-// Calculate nutrition score based on goal
-// Time Complexity: O(1)
-// Space Complexity: O(1)
-int calculateScore(char *goal, int calories, float protein, float carbs) {
-    int score = 0;
-    
-    if (strcmp(goal, "weight-loss") == 0) {
-        // High protein + low calories = higher score
-        score = (int)(protein * 3) - (calories / 10);
-    } else if (strcmp(goal, "muscle-gain") == 0) {
-        // High protein + moderate calories = higher score
-        score = (int)(protein * 4) + (calories / 20);
-    } else if (strcmp(goal, "maintain") == 0) {
-        // Balanced nutrition
-        score = (int)(protein * 2.5);
-    } else if (strcmp(goal, "pcod") == 0) {
-        // Low carbs + moderate protein
-        score = (int)(protein * 2) - (int)(carbs / 5);
-    } else {
-        // Default balanced score
-        score = (int)(protein * 2);
-    }
-    
-    return score;
+// ================= BATCH SCORING =================
+// calculateScore (per meal, goal string resolved every call), scoreBatch
+// (one goal, vectorized loop) and scoreAllGoals (every goal in one pass)
+// all come from meal_scoring.h and share its scoreMeal rule.
+
+// Compare per-meal calculateScore calls with the batch kernels
+void benchmarkScoring(int n) {
+    int *calories = (int*)malloc(n * sizeof(int));
+    float *protein = (float*)malloc(n * sizeof(float));
+    float *carbs = (float*)malloc(n * sizeof(float));
+    int *expected = (int*)malloc((size_t)NUM_GOALS * n * sizeof(int));
+    int *matrix = (int*)malloc((size_t)NUM_GOALS * n * sizeof(int));
+
+    srand(9);
+    for (int i = 0; i < n; i++) {
+        calories[i] = 100 + rand() % 500;
+        protein[i] = (float)(rand() % 400) / 10.0f;
+        carbs[i] = (float)(rand() % 800) / 10.0f;
+    }
+
+    clock_t start = clock();
+    for (int g = 0; g < NUM_GOALS; g++) {
+        char goal[20];
+        strcpy(goal, goalName(g));
+        for (int i = 0; i < n; i++) {
+            expected[(size_t)g * n + i] = calculateScore(goal, calories[i], protein[i], carbs[i]);
+        }
+    }
+    double scalarMs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (int g = 0; g < NUM_GOALS; g++) {
+        scoreBatch((Goal)g, calories, protein, carbs, n, matrix + (size_t)g * n);
+    }
+    double batchMs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+    int same = memcmp(expected, matrix, (size_t)NUM_GOALS * n * sizeof(int)) == 0;
+
+    memset(matrix, 0, (size_t)NUM_GOALS * n * sizeof(int));
+    start = clock();
+    scoreAllGoals(calories, protein, carbs, n, matrix);
+    double allMs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+    same = same && memcmp(expected, matrix, (size_t)NUM_GOALS * n * sizeof(int)) == 0;
+
+    printf("\n=== BENCHMARK: %d meals x %d goals ===\n", n, NUM_GOALS);
+    printf("calculateScore per meal : %8.1f ms\n", scalarMs);
+    printf("scoreBatch per goal     : %8.1f ms\n", batchMs);
+    printf("scoreAllGoals one pass  : %8.1f ms\n", allMs);
+    printf("Same scores: %s\n", same ? "Yes" : "No");
+
+    free(calories);
+    free(protein);
+    free(carbs);
+    free(expected);
+    free(matrix);
+}
+
+// ================= BOUNDED TOP-K SELECTION =================
+// Ranks a whole catalogue without copying Meal structs or capping at
+// MAX_SIZE, using the TopKSelector from meal_scoring.h.
+
+// Score every catalogue row for a goal and return the best k, best first
+// Rows are scored with scoreBatch in chunks, then offered to the selector
+// Time Complexity: O(n log k)
+// Space Complexity: O(k)
+int rankCatalogue(char *goal, const int *calories, const float *protein, const float *carbs,
+                  int n, int k, ScoredRow *out) {
+    TopKSelector sel;
+    if (initTopK(&sel, k) != 0) return 0;
+    Goal resolved = parseGoal(goal);
+    int scores[1024];
+    for (int base = 0; base < n; base += 1024) {
+        int chunk = n - base < 1024 ? n - base : 1024;
+        scoreBatch(resolved, calories + base, protein + base, carbs + base, chunk, scores);
+        for (int i = 0; i < chunk; i++) offerTopK(&sel, scores[i], (uint32_t)(base + i));
+    }
+    int count = finishTopK(&sel, out);
+    freeTopK(&sel);
+    return count;
+}
+
+// Compare top-K selection against scoring + sorting the whole catalogue
+void benchmarkTopK(int n, int k) {
+    int *calories = (int*)malloc(n * sizeof(int));
+    float *protein = (float*)malloc(n * sizeof(float));
+    float *carbs = (float*)malloc(n * sizeof(float));
+    ScoredRow *all = (ScoredRow*)malloc(n * sizeof(ScoredRow));
+    ScoredRow *top = (ScoredRow*)malloc(k * sizeof(ScoredRow));
+    char goal[] = "weight-loss";
+
+    srand(5);
+    for (int i = 0; i < n; i++) {
+        calories[i] = 100 + rand() % 500;
+        protein[i] = (float)(rand() % 400) / 10.0f;
+        carbs[i] = (float)(rand() % 800) / 10.0f;
+    }
+
+    clock_t start = clock();
+    for (int i = 0; i < n; i++) {
+        all[i].score = calculateScore(goal, calories[i], protein[i], carbs[i]);
+        all[i].rowId = (uint32_t)i;
+    }
+    qsort(all, n, sizeof(ScoredRow), compareScoredRows);
+    double sortMs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+    start = clock();
+    int count = rankCatalogue(goal, calories, protein, carbs, n, k, top);
+    double topKMs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+    int same = count == k;
+    for (int i = 0; same && i < k; i++) {
+        same = all[i].rowId == top[i].rowId && all[i].score == top[i].score;
+    }
+
+    printf("\n=== BENCHMARK: top %d of %d meals (%s) ===\n", k, n, goal);
+    printf("Score + full sort : %8.1f ms\n", sortMs);
+    printf("Top-K min-heap    : %8.1f ms\n", topKMs);
+    printf("Same ranking: %s\n", same ? "Yes" : "No");
+
+    free(calories);
+    free(protein);
+    free(carbs);
+    free(all);
+    free(top);
 }
 
 // Display meal details
 void displayMeal(Meal meal, int rank) {
-    printf("\n#%d: %s (%s)\n", rank, meal.name, meal.hindiName);
+    printf("\n#%d: %s (%s)\n", rank, poolString(&mealNames, meal.name),
+           poolString(&mealNames, meal.hindiName));
     printf("    Calories: %d kcal | Protein: %.1fg | Carbs: %.1fg | Fats: %.1fg\n", 
            meal.calories, meal.protein, meal.carbs, meal.fats);
     printf("    Cost: Rs.%d | Nutrition Score: %d\n", meal.cost, meal.score);
@@ -166,6 +273,7 @@ void displayMeal(Meal meal, int rank) {
 // Main function demonstrating Priority Queue
 int main() {
     PriorityQueue pq;
+    if (initStringPool(&mealNames) != 0) return 1;
     initPQ(&pq);
     
     printf("=== NutriPlan Meal Ranking System (Priority Queue) ===\n\n");
@@ -225,6 +333,51 @@ int main() {
         displayMeal(best, i);
     }
     
+    // Test Case 3: Rank the whole catalogue with a bounded top-K selector
+    printf("\n\n==========================================================\n");
+    printf("WHOLE CATALOGUE RANKING (Top-K, no queue size limit)\n");
+    printf("---------------------------------------------------\n");
+    
+    char *names[] = { "Moong Dal Cheela", "Paneer Bhurji", "Chicken Curry", "Poha",
+                      "Egg Curry", "Dal Tadka", "Chole", "Fish Curry" };
+    int calories[] = { 180, 265, 380, 250, 350, 320, 420, 320 };
+    float protein[] = { 12.0, 18.5, 32.0, 6.0, 20.0, 14.0, 18.0, 28.0 };
+    float carbs[] = { 25.0, 8.0, 12.0, 40.0, 18.0, 48.0, 65.0, 22.0 };
+    int numMeals = 8;
+    char *goals[] = { goal1, goal2, "pcod" };
+    ScoredRow top[3];
+    
+    for (int g = 0; g < 3; g++) {
+        int count = rankCatalogue(goals[g], calories, protein, carbs, numMeals, 3, top);
+        printf("\nTOP %d for %s:\n", count, goals[g]);
+        for (int i = 0; i < count; i++) {
+            printf("  #%d: %-18s score %d\n", i + 1, names[top[i].rowId], top[i].score);
+        }
+    }
+    
+    // Test Case 4: Precompute every goal's scores at once
+    printf("\n\n==========================================================\n");
+    printf("SCORE MATRIX (all goals, one pass)\n");
+    printf("---------------------------------------------------\n");
+    
+    int matrix[NUM_GOALS * 8];
+    scoreAllGoals(calories, protein, carbs, numMeals, matrix);
+    printf("%-18s", "");
+    for (int g = 0; g < NUM_GOALS; g++) printf("%12s", goalName(g));
+    printf("\n");
+    for (int i = 0; i < numMeals; i++) {
+        printf("%-18s", names[i]);
+        for (int g = 0; g < NUM_GOALS; g++) printf("%12d", matrix[g * numMeals + i]);
+        printf("\n");
+    }
+    
+    benchmarkTopK(1000000, 10);
+    benchmarkScoring(1000000);
+    
+    printf("\nMeal record: %zu bytes (was %zu with char[50] names)\n",
+           sizeof(Meal), 2 * 50 + 6 * sizeof(int));
+    freeStringPool(&mealNames);
+    
     printf("\n\n=== Priority Queue successfully ranks meals by goal! ===\n");
     
     return 0;
@@ -0,0 +1,523 @@
+// Full-Text Keyword Index over Recipe Steps
+// NutriPlan - Data Structures Project
+// Inverted index token -> posting list of steps, built once over every
+// recipe step in the catalogue. Multi-keyword AND queries intersect the
+// posting lists rarest-first with galloping search, so a query touches
+// only the steps that mention its words instead of scanning all text.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <time.h>
+#include "catalogue_format.h"
+#include "string_pool.h"
+
+#define MAX_TOKEN 64      // longer words are truncated (index and query alike)
+#define MAX_KEYWORDS 8
+
+// Steps are numbered globally in catalogue order; a recipe owns the
+// range [stepStart[r], stepStart[r + 1])
+typedef struct {
+    uint32_t numRecipes;
+    uint32_t numSteps;
+    const char **stepText;     // [numSteps], not owned
+    uint32_t *stepStart;       // [numRecipes + 1]
+    uint32_t *stepRecipe;      // [numSteps] owning recipe of each step
+
+    // Term dictionary
+    StringPool tokens;
+    StringId *termText;        // [numTerms]
+    uint32_t *termSlots;       // open addressing of term + 1 (0 = empty slot)
+    uint32_t slotCount;        // power of two
+    uint32_t numTerms;
+    uint32_t termCapacity;
+
+    // Posting lists in CSR form: term t owns postings[postingStart[t] ..
+    // postingStart[t + 1]), ascending global step ids, one per step
+    uint32_t *postingStart;    // [numTerms + 1]
+    uint32_t *postings;
+    uint32_t numPostings;
+} RecipeIndex;
+
+// One matching step
+typedef struct {
+    uint32_t recipe;
+    uint32_t step;             // position inside the recipe, 0-based
+} StepHit;
+
+// ================= TOKENIZER =================
+
+// Next word of *cursor into token (lowercase ASCII letters and digits;
+// UTF-8 bytes are kept so Hindi words index too)
+// Returns the token length, 0 at end of text
+int nextToken(const char **cursor, char *token) {
+    const unsigned char *p = (const unsigned char*)*cursor;
+    while (*p != '\0' && !isalnum(*p) && *p < 0x80) p++;
+
+    int length = 0;
+    while (*p != '\0' && (isalnum(*p) || *p >= 0x80)) {
+        if (length < MAX_TOKEN - 1) token[length++] = (char)tolower(*p);
+        p++;
+    }
+    token[length] = '\0';
+    *cursor = (const char*)p;
+    return length;
+}
+
+// ================= TERM DICTIONARY =================
+
+// Term index of token, -1 if it never occurs
+// Time Complexity: O(length) expected
+int findTerm(const RecipeIndex *index, const char *token) {
+    uint32_t mask = index->slotCount - 1;
+    for (uint32_t h = poolHash(token) & mask; index->termSlots[h] != 0; h = (h + 1) & mask) {
+        uint32_t term = index->termSlots[h] - 1;
+        if (strcmp(poolString(&index->tokens, index->termText[term]), token) == 0) return (int)term;
+    }
+    return -1;
+}
+
+// Double the slot table and the per-term arrays
+// Returns 0 on success, -1 if out of memory
+int growTerms(RecipeIndex *index, uint32_t **lastStep) {
+    uint32_t capacity = index->termCapacity * 2;
+    StringId *text = (StringId*)realloc(index->termText, capacity * sizeof(StringId));
+    if (text != NULL) index->termText = text;
+    uint32_t *start = (uint32_t*)realloc(index->postingStart, (capacity + 1) * sizeof(uint32_t));
+    if (start != NULL) index->postingStart = start;
+    uint32_t *last = (uint32_t*)realloc(*lastStep, capacity * sizeof(uint32_t));
+    if (last != NULL) *lastStep = last;
+    uint32_t slotCount = index->slotCount * 2;
+    uint32_t *slots = (uint32_t*)calloc(slotCount, sizeof(uint32_t));
+    if (text == NULL || start == NULL || last == NULL || slots == NULL) {
+        free(slots);
+        printf("❌ Memory allocation failed!\n");
+        return -1;
+    }
+
+    for (uint32_t term = 0; term < index->numTerms; term++) {
+        uint32_t h = poolHash(poolString(&index->tokens, text[term])) & (slotCount - 1);
+        while (slots[h] != 0) h = (h + 1) & (slotCount - 1);
+        slots[h] = term + 1;
+    }
+    free(index->termSlots);
+    index->termSlots = slots;
+    index->slotCount = slotCount;
+    index->termCapacity = capacity;
+    return 0;
+}
+
+// Term index of token, adding it (with zero postings) on first sight
+// Returns -1 if out of memory
+int addTerm(RecipeIndex *index, const char *token, uint32_t **lastStep) {
+    int term = findTerm(index, token);
+    if (term >= 0) return term;
+    if (index->numTerms == index->termCapacity && growTerms(index, lastStep) != 0) return -1;
+
+    term = (int)index->numTerms++;
+    index->termText[term] = internString(&index->tokens, token);
+    index->postingStart[term] = 0;
+    (*lastStep)[term] = 0;
+    uint32_t mask = index->slotCount - 1;
+    uint32_t h = poolHash(token) & mask;
+    while (index->termSlots[h] != 0) h = (h + 1) & mask;
+    index->termSlots[h] = (uint32_t)term + 1;
+    return term;
+}
+
+// ================= BUILD =================
+
+void freeRecipeIndex(RecipeIndex *index) {
+    free(index->stepStart);
+    free(index->stepRecipe);
+    freeStringPool(&index->tokens);
+    free(index->termText);
+    free(index->termSlots);
+    free(index->postingStart);
+    free(index->postings);
+    memset(index, 0, sizeof(RecipeIndex));
+}
+
+// Index numRecipes recipes whose steps are stepText[stepStart[r] ..
+// stepStart[r + 1]). stepText must outlive the index.
+// Two passes over the text: count postings per term, then fill them
+// Returns 0 on success, -1 on error (message printed)
+// Time Complexity: O(total text length)
+// Space Complexity: O(terms + postings)
+int buildRecipeIndex(RecipeIndex *index, const char **stepText, const uint32_t *stepStart,
+                     uint32_t numRecipes) {
+    memset(index, 0, sizeof(RecipeIndex));
+    uint32_t numSteps = stepStart[numRecipes];
+    index->numRecipes = numRecipes;
+    index->numSteps = numSteps;
+    index->stepText = stepText;
+    index->stepStart = (uint32_t*)malloc((numRecipes + 1) * sizeof(uint32_t));
+    index->stepRecipe = (uint32_t*)malloc((numSteps > 0 ? numSteps : 1) * sizeof(uint32_t));
+    index->termCapacity = 256;
+    index->slotCount = 512;
+    index->termText = (StringId*)malloc(index->termCapacity * sizeof(StringId));
+    index->termSlots = (uint32_t*)calloc(index->slotCount, sizeof(uint32_t));
+    index->postingStart = (uint32_t*)malloc((index->termCapacity + 1) * sizeof(uint32_t));
+    uint32_t *lastStep = (uint32_t*)malloc(index->termCapacity * sizeof(uint32_t));  // step id + 1
+    if (index->stepStart == NULL || index->stepRecipe == NULL || index->termText == NULL ||
+        index->termSlots == NULL || index->postingStart == NULL || lastStep == NULL ||
+        initStringPool(&index->tokens) != 0) {
+        printf("❌ Memory allocation failed!\n");
+        free(lastStep);
+        freeRecipeIndex(index);
+        return -1;
+    }
+    memcpy(index->stepStart, stepStart, (numRecipes + 1) * sizeof(uint32_t));
+    for (uint32_t r = 0; r < numRecipes; r++) {
+        for (uint32_t s = stepStart[r]; s < stepStart[r + 1]; s++) index->stepRecipe[s] = r;
+    }
+
+    // Pass 1: dictionary and posting counts (a word repeated in one step counts once)
+    char token[MAX_TOKEN];
+    for (uint32_t s = 0; s < numSteps; s++) {
+        const char *cursor = stepText[s];
+        while (nextToken(&cursor, token) > 0) {
+            int term = addTerm(index, token, &lastStep);
+            if (term < 0) {
+                free(lastStep);
+                freeRecipeIndex(index);
+                return -1;
+            }
+            if (lastStep[term] != s + 1) {
+                lastStep[term] = s + 1;
+                index->postingStart[term]++;
+            }
+        }
+    }
+
+    // Prefix sums; postingStart[t] becomes the fill cursor of term t
+    uint32_t total = 0;
+    for (uint32_t t = 0; t < index->numTerms; t++) {
+        uint32_t count = index->postingStart[t];
+        index->postingStart[t] = total;
+        total += count;
+        lastStep[t] = 0;
+    }
+    index->postingStart[index->numTerms] = total;
+    index->numPostings = total;
+    index->postings = (uint32_t*)malloc((total > 0 ? total : 1) * sizeof(uint32_t));
+    if (index->postings == NULL) {
+        printf("❌ Memory allocation failed!\n");
+        free(lastStep);
+        freeRecipeIndex(index);
+        return -1;
+    }
+
+    // Pass 2: scatter step ids (ascending, since steps are visited in order)
+    for (uint32_t s = 0; s < numSteps; s++) {
+        const char *cursor = stepText[s];
+        while (nextToken(&cursor, token) > 0) {
+            int term = findTerm(index, token);
+            if (lastStep[term] != s + 1) {
+                lastStep[term] = s + 1;
+                index->postings[index->postingStart[term]++] = s;
+            }
+        }
+    }
+    for (uint32_t t = index->numTerms; t > 0; t--) {
+        index->postingStart[t] = index->postingStart[t - 1];  // undo the cursor shift
+    }
+    index->postingStart[0] = 0;
+
+    free(lastStep);
+    return 0;
+}
+
+// ================= QUERIES =================
+
+// Posting list of one keyword
+typedef struct {
+    const uint32_t *ids;
+    uint32_t length;
+    uint32_t cursor;
+} PostingCursor;
+
+// Split query into distinct keywords and look up their posting lists,
+// rarest first. Returns the number of keywords, 0 if the query is empty
+// or any keyword never occurs (the AND is then empty)
+int openKeywords(const RecipeIndex *index, const char *query, PostingCursor *lists) {
+    char token[MAX_TOKEN];
+    int terms[MAX_KEYWORDS];
+    int count = 0;
+    while (nextToken(&query, token) > 0) {
+        int term = findTerm(index, token);
+        if (term < 0) return 0;
+        int seen = 0;
+        for (int i = 0; i < count; i++) seen |= terms[i] == term;
+        if (seen) continue;
+        if (count == MAX_KEYWORDS) {
+            printf("❌ At most %d keywords per query\n", MAX_KEYWORDS);
+            return 0;
+        }
+        terms[count++] = term;
+    }
+
+    for (int i = 0; i < count; i++) {
+        uint32_t start = index->postingStart[terms[i]];
+        PostingCursor list = { index->postings + start, index->postingStart[terms[i] + 1] - start, 0 };
+        int j = i;
+        while (j > 0 && lists[j - 1].length > list.length) {
+            lists[j] = lists[j - 1];
+            j--;
+        }
+        lists[j] = list;
+    }
+    return count;
+}
+
+// Move the cursor to the first id >= target (exponential then binary search)
+// Time Complexity: O(log distance)
+static inline void gallop(PostingCursor *list, uint32_t target) {
+    uint32_t lo = list->cursor, step = 1;
+    uint32_t hi = lo;
+    while (hi < list->length && list->ids[hi] < target) {
+        lo = hi + 1;
+        hi += step;
+        step *= 2;
+    }
+    if (hi > list->length) hi = list->length;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (list->ids[mid] < target) lo = mid + 1;
+        else hi = mid;
+    }
+    list->cursor = lo;
+}
+
+// Every step that contains all words of query (case-insensitive, whole
+// words), in catalogue order. Writes up to maxHits hits
+// Returns the number of matching steps
+// Time Complexity: O(k * r log(n / r)) for k keywords, rarest list r long
+int searchSteps(const RecipeIndex *index, const char *query, StepHit *hits, int maxHits) {
+    PostingCursor lists[MAX_KEYWORDS];
+    int k = openKeywords(index, query, lists);
+    int found = 0;
+    if (k == 0) return 0;
+
+    for (uint32_t i = 0; i < lists[0].length; i++) {
+        uint32_t step = lists[0].ids[i];
+        int all = 1;
+        for (int j = 1; j < k && all; j++) {
+            gallop(&lists[j], step);
+            all = lists[j].cursor < lists[j].length && lists[j].ids[lists[j].cursor] == step;
+        }
+        if (!all) continue;
+        if (found < maxHits) {
+            uint32_t recipe = index->stepRecipe[step];
+            hits[found].recipe = recipe;
+            hits[found].step = step - index->stepStart[recipe];
+        }
+        found++;
+    }
+    return found;
+}
+
+// Every recipe whose steps, taken together, contain all words of query.
+// Writes up to maxRecipes recipe ids in catalogue order
+// Returns the number of matching recipes
+// Time Complexity: O(k * r log(n / r))
+int searchRecipes(const RecipeIndex *index, const char *query, uint32_t *recipes, int maxRecipes) {
+    PostingCursor lists[MAX_KEYWORDS];
+    int k = openKeywords(index, query, lists);
+    int found = 0;
+    if (k == 0) return 0;
+
+    uint32_t i = 0;
+    while (i < lists[0].length) {
+        uint32_t recipe = index->stepRecipe[lists[0].ids[i]];
+        uint32_t first = index->stepStart[recipe], end = index->stepStart[recipe + 1];
+        int all = 1;
+        for (int j = 1; j < k && all; j++) {
+            gallop(&lists[j], first);
+            all = lists[j].cursor < lists[j].length && lists[j].ids[lists[j].cursor] < end;
+        }
+        if (all) {
+            if (found < maxRecipes) recipes[found] = recipe;
+            found++;
+        }
+        lists[0].cursor = i;
+        gallop(&lists[0], end);  // skip this recipe's other steps
+        i = lists[0].cursor;
+    }
+    return found;
+}
+
+// ================= BASELINE =================
+
+// Does text contain word as a whole token?
+int stepHasWord(const char *text, const char *word) {
+    char token[MAX_TOKEN];
+    while (nextToken(&text, token) > 0) {
+        if (strcmp(token, word) == 0) return 1;
+    }
+    return 0;
+}
+
+// Scan every step of every recipe for all keywords (what searchStep does
+// for one recipe); same results as searchSteps
+int scanSteps(const char **stepText, uint32_t numSteps, const char *query, uint32_t *matches) {
+    char words[MAX_KEYWORDS][MAX_TOKEN];
+    int k = 0;
+    while (k < MAX_KEYWORDS && nextToken(&query, words[k]) > 0) k++;
+    if (k == 0) return 0;
+
+    int found = 0;
+    for (uint32_t s = 0; s < numSteps; s++) {
+        int all = 1;
+        for (int j = 0; j < k && all; j++) all = stepHasWord(stepText[s], words[j]);
+        if (all) matches[found++] = s;
+    }
+    return found;
+}
+
+// ================= DEMO AND BENCHMARK =================
+
+double elapsedMs(struct timespec start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start.tv_sec) * 1000.0 + (now.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+// Step text pointers of a mapped catalogue
+const char** catalogueSteps(const NpcatFile *cat) {
+    uint32_t numSteps = cat->header->numSteps;
+    const char **text = (const char**)malloc((numSteps > 0 ? numSteps : 1) * sizeof(char*));
+    if (text == NULL) return NULL;
+    for (uint32_t s = 0; s < numSteps; s++) text[s] = npcatText(cat, NPCAT_STEPS, s);
+    return text;
+}
+
+void printStepHits(const RecipeIndex *index, const NpcatFile *cat, const char *query) {
+    StepHit hits[32];
+    int found = searchSteps(index, query, hits, 32);
+    printf("\n🔍 Steps with \"%s\": %d\n", query, found);
+    for (int i = 0; i < found && i < 32; i++) {
+        printf("  %-22s step %u: %s\n", npcatText(cat, NPCAT_FOOD_NAME, hits[i].recipe),
+               hits[i].step + 1,
+               index->stepText[index->stepStart[hits[i].recipe] + hits[i].step]);
+    }
+}
+
+void printRecipeHits(const RecipeIndex *index, const NpcatFile *cat, const char *query) {
+    uint32_t recipes[32];
+    int found = searchRecipes(index, query, recipes, 32);
+    printf("\n📖 Recipes using \"%s\": %d\n  ", query, found);
+    if (found == 0) printf("(none)");
+    for (int i = 0; i < found && i < 32; i++) {
+        printf("%s%s", i > 0 ? ", " : "", npcatText(cat, NPCAT_FOOD_NAME, recipes[i]));
+    }
+    printf("\n");
+}
+
+// Index the real catalogue and run a few ingredient searches
+void demoCatalogue(const char *path) {
+    NpcatFile cat;
+    if (npcatOpen(path, &cat) != 0) {
+        printf("   Run catalogue_compiler first to build %s\n", path);
+        return;
+    }
+    const char **text = catalogueSteps(&cat);
+    const uint32_t *stepStart = (const uint32_t*)npcatSection(&cat, NPCAT_FOOD_STEP_START);
+    RecipeIndex index;
+    if (text != NULL && buildRecipeIndex(&index, text, stepStart, cat.header->numFoods) == 0) {
+        printf("✅ Indexed %u steps of %u recipes: %u terms, %u postings\n",
+               index.numSteps, index.numRecipes, index.numTerms, index.numPostings);
+        printStepHits(&index, &cat, "tomatoes");
+        printStepHits(&index, &cat, "paneer");
+        printStepHits(&index, &cat, "Ghee");
+        printStepHits(&index, &cat, "add onions");
+        printRecipeHits(&index, &cat, "onions tomatoes");
+        printRecipeHits(&index, &cat, "green chili coriander");
+        printRecipeHits(&index, &cat, "saffron");
+        freeRecipeIndex(&index);
+    }
+    free(text);
+    npcatClose(&cat);
+}
+
+// Synthetic catalogue of numRecipes recipes, each with stepsEach steps
+// drawn from a small vocabulary of cooking phrases
+void benchmarkIndex(uint32_t numRecipes, uint32_t stepsEach, int repeats) {
+    const char *verbs[] = { "Add", "Heat", "Fry", "Boil", "Mix", "Chop", "Grind", "Soak",
+                            "Simmer", "Roast", "Stir", "Garnish with" };
+    const char *items[] = { "onions", "tomatoes", "paneer", "ghee", "ginger", "garlic", "rice",
+                            "dal", "chicken", "eggs", "spinach", "potatoes", "peas", "curd",
+                            "cumin seeds", "coriander", "green chili", "mustard seeds",
+                            "curry leaves", "turmeric", "besan", "oats", "lemon juice", "jaggery" };
+    const char *tails[] = { "for 2 minutes", "until golden", "on low flame", "and mix well",
+                            "in a pan", "until soft", "and cover", "for 10 minutes" };
+    int numVerbs = 12, numItems = 24, numTails = 8;
+
+    uint32_t numSteps = numRecipes * stepsEach;
+    char *buffer = (char*)malloc((size_t)numSteps * 80);
+    const char **text = (const char**)malloc(numSteps * sizeof(char*));
+    uint32_t *stepStart = (uint32_t*)malloc((numRecipes + 1) * sizeof(uint32_t));
+    uint32_t *matches = (uint32_t*)malloc(numSteps * sizeof(uint32_t));
+    StepHit *hits = (StepHit*)malloc(numSteps * sizeof(StepHit));
+    srand(5);
+    for (uint32_t s = 0; s < numSteps; s++) {
+        char *line = buffer + (size_t)s * 80;
+        snprintf(line, 80, "%s %s and %s %s", verbs[rand() % numVerbs], items[rand() % numItems],
+                 items[rand() % numItems], tails[rand() % numTails]);
+        text[s] = line;
+    }
+    for (uint32_t r = 0; r <= numRecipes; r++) stepStart[r] = r * stepsEach;
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    RecipeIndex index;
+    if (buildRecipeIndex(&index, text, stepStart, numRecipes) != 0) return;
+    double buildMs = elapsedMs(start);
+
+    const char *queries[] = { "tomatoes", "paneer ghee", "jaggery besan oats", "fry onions golden" };
+    printf("=== BENCHMARK: %u recipes, %u steps (index built in %.1f ms, %u postings) ===\n",
+           numRecipes, numSteps, buildMs, index.numPostings);
+    for (int q = 0; q < 4; q++) {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        int scanned = scanSteps(text, numSteps, queries[q], matches);
+        double scanMs = elapsedMs(start);
+
+        int found = 0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (int rep = 0; rep < repeats; rep++) {
+            found = searchSteps(&index, queries[q], hits, (int)numSteps);
+        }
+        double indexUs = elapsedMs(start) * 1000.0 / repeats;
+
+        int same = found == scanned;
+        for (int i = 0; same && i < found; i++) {
+            same = stepStart[hits[i].recipe] + hits[i].step == matches[i];
+        }
+        printf("%-20s %7d hits | scan %8.1f ms | index %9.1f µs | same: %s\n",
+               queries[q], found, scanMs, indexUs, same ? "Yes" : "No");
+    }
+    printf("\n");
+
+    freeRecipeIndex(&index);
+    free(buffer);
+    free(text);
+    free(stepStart);
+    free(matches);
+    free(hits);
+}
+
+// Build: gcc -O2 recipe_index.c
+// Usage: recipe_index [catalogue.npcat]
+int main(int argc, char **argv) {
+    const char *path = argc > 1 ? argv[1] : "catalogue.npcat";
+
+    printf("\n=== NutriPlan Recipe Step Search (Inverted Index) ===\n\n");
+    demoCatalogue(path);
+    printf("\n");
+    benchmarkIndex(200000, 6, 20);
+
+    printf("=== Ingredient search across every recipe in microseconds ===\n\n");
+    return 0;
+}
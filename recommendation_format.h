@@ -0,0 +1,169 @@
+// Precomputed Recommendation Table Format (.nprec)
+// NutriPlan - Data Structures Project
+// Written by recommendation_table.c from a .npcat catalogue. Holds the
+// ranked top-K foods for every (goal, dietType, budget, mealTime) cell so
+// serving a recommendation is one array read instead of filter + sort.
+//
+// File = header, then two sections aligned to 64 bytes:
+//   COUNTS  uint8[numCells]          rows filled in each cell (<= k)
+//   ENTRIES NprecEntry[numCells * k] best first, unused slots zeroed
+// Axis indices are the tag indices of the catalogue the table was built
+// from (resolve names with npcatTagIndex), cells are laid out
+// goal-major: ((goal * diets + diet) * budgets + budget) * mealTimes + time.
+// All integers are little-endian.
+
+#ifndef RECOMMENDATION_FORMAT_H
+#define RECOMMENDATION_FORMAT_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define NPREC_MAGIC "NPREC\0\0\0"
+#define NPREC_VERSION 1
+#define NPREC_ALIGN 64
+#define NPREC_MAX_TAGS 8   // per axis, as NPCAT_MAX_TAGS
+#define NPREC_MAX_K 255    // per-cell counts are one byte
+
+// One ranked food: row id in the source catalogue plus its goal score
+typedef struct {
+    int32_t score;
+    uint32_t rowId;
+} NprecEntry;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t headerSize;
+    uint64_t fileSize;
+    uint64_t catalogueSize;   // fileSize of the .npcat it was built from
+    uint32_t numFoods;        // numFoods of that catalogue
+    uint32_t numGoals;
+    uint32_t numDietTypes;
+    uint32_t numBudgets;
+    uint32_t numMealTimes;
+    uint32_t numCells;
+    uint32_t k;
+    uint32_t reserved;
+    uint64_t countsOffset;
+    uint64_t entriesOffset;
+} NprecHeader;
+
+// Read-only view of a mapped table
+typedef struct {
+    const uint8_t *base;
+    size_t size;
+    const NprecHeader *header;
+    const uint8_t *counts;
+    const NprecEntry *entries;
+} NprecFile;
+
+// Check everything nprecLookup and its callers index without further
+// checks: axis sizes and k bounded before any product is formed, both
+// sections inside the file, every count <= k and every filled row id
+// inside the source catalogue
+// Returns NULL if the table is consistent, otherwise what is wrong
+// Time Complexity: O(cells * k)
+static inline const char* nprecValidate(const uint8_t *base, const NprecHeader *h) {
+    if (h->numGoals > NPREC_MAX_TAGS || h->numDietTypes > NPREC_MAX_TAGS ||
+        h->numBudgets > NPREC_MAX_TAGS || h->numMealTimes > NPREC_MAX_TAGS) {
+        return "too many tag names";
+    }
+    if (h->k < 1 || h->k > NPREC_MAX_K) return "k out of range";
+    uint64_t cells = (uint64_t)h->numGoals * h->numDietTypes * h->numBudgets * h->numMealTimes;
+    if (h->numCells != cells) return "cell count does not match the axes";
+
+    // cells <= 8^4 and k <= 255, so these products cannot overflow
+    uint64_t entriesSize = cells * h->k * sizeof(NprecEntry);
+    if (h->countsOffset % NPREC_ALIGN != 0 || h->entriesOffset % NPREC_ALIGN != 0 ||
+        h->countsOffset < sizeof(NprecHeader) || h->entriesOffset < sizeof(NprecHeader) ||
+        h->countsOffset > h->fileSize || cells > h->fileSize - h->countsOffset ||
+        h->entriesOffset > h->fileSize || entriesSize > h->fileSize - h->entriesOffset) {
+        return "section outside the file";
+    }
+
+    const uint8_t *counts = base + h->countsOffset;
+    const NprecEntry *entries = (const NprecEntry*)(base + h->entriesOffset);
+    for (uint64_t c = 0; c < cells; c++) {
+        if (counts[c] > h->k) return "cell count larger than k";
+        for (uint32_t i = 0; i < counts[c]; i++) {
+            if (entries[c * h->k + i].rowId >= h->numFoods) return "row id outside the catalogue";
+        }
+    }
+    return NULL;
+}
+
+// Map a table and validate it (see nprecValidate)
+// Returns 0 on success, -1 on error (message printed)
+static inline int nprecOpen(const char *path, NprecFile *table) {
+    memset(table, 0, sizeof(NprecFile));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("❌ Cannot open recommendation table %s\n", path);
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(NprecHeader)) {
+        printf("❌ Recommendation table %s is truncated\n", path);
+        close(fd);
+        return -1;
+    }
+    void *base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        printf("❌ Cannot mmap recommendation table %s\n", path);
+        return -1;
+    }
+
+    const NprecHeader *h = (const NprecHeader*)base;
+    if (memcmp(h->magic, NPREC_MAGIC, 8) != 0 || h->version != NPREC_VERSION ||
+        h->headerSize != sizeof(NprecHeader) || h->fileSize != (uint64_t)st.st_size) {
+        printf("❌ %s is not a version %d recommendation table\n", path, NPREC_VERSION);
+        munmap(base, (size_t)st.st_size);
+        return -1;
+    }
+    const char *problem = nprecValidate((const uint8_t*)base, h);
+    if (problem != NULL) {
+        printf("❌ Recommendation table %s is corrupt: %s\n", path, problem);
+        munmap(base, (size_t)st.st_size);
+        return -1;
+    }
+
+    table->base = (const uint8_t*)base;
+    table->size = (size_t)st.st_size;
+    table->header = h;
+    table->counts = table->base + h->countsOffset;
+    table->entries = (const NprecEntry*)(table->base + h->entriesOffset);
+    return 0;
+}
+
+static inline void nprecClose(NprecFile *table) {
+    if (table->base != NULL) munmap((void*)table->base, table->size);
+    memset(table, 0, sizeof(NprecFile));
+}
+
+// Cell index for tag indices; -1 if any index is out of range
+static inline int nprecCellIndex(const NprecFile *table, int goal, int diet, int budget, int time) {
+    const NprecHeader *h = table->header;
+    if (goal < 0 || diet < 0 || budget < 0 || time < 0 ||
+        (uint32_t)goal >= h->numGoals || (uint32_t)diet >= h->numDietTypes ||
+        (uint32_t)budget >= h->numBudgets || (uint32_t)time >= h->numMealTimes) {
+        return -1;
+    }
+    return (int)(((goal * h->numDietTypes + diet) * h->numBudgets + budget) * h->numMealTimes + time);
+}
+
+// Ranked foods of one cell, best first; *count is 0 for empty or invalid cells
+// Time Complexity: O(1)
+static inline const NprecEntry* nprecLookup(const NprecFile *table, int goal, int diet,
+                                            int budget, int time, int *count) {
+    int cell = nprecCellIndex(table, goal, diet, budget, time);
+    *count = cell < 0 ? 0 : table->counts[cell];
+    return cell < 0 ? NULL : table->entries + (size_t)cell * table->header->k;
+}
+
+#endif
@@ -0,0 +1,397 @@
+// Recommendation Table Builder: .npcat catalogue -> precomputed top-K table
+// NutriPlan - Data Structures Project
+// Batch job on top of the meal_scoring.h scoring rules. Every food is
+// scored once per goal rule, then offered to the bounded top-K selector of
+// each (goal, dietType, budget, mealTime) cell it is tagged for. The result
+// (see recommendation_format.h) replaces the hand-written foodDatabase
+// object in meals.html and its per-page-load sort.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "catalogue_format.h"
+#include "recommendation_format.h"
+#include "meal_scoring.h"
+
+#define DEFAULT_K 5
+
+// The entries block is written out as-is, so the selector's rows must
+// have the on-disk NprecEntry layout
+_Static_assert(sizeof(ScoredRow) == sizeof(NprecEntry), "ScoredRow must match NprecEntry");
+
+// ================= TABLE BUILDER =================
+
+// All cells share one entries block, so cell c's selector heap is the
+// output slice entries[c * k .. c * k + k) and needs no copy when written
+typedef struct {
+    NprecHeader header;
+    uint8_t *counts;
+    ScoredRow *entries;
+    TopKSelector *cells;
+} TableBuilder;
+
+// Rank every cell of the catalogue
+// Time Complexity: O(n * tags * log k) - each food only touches the cells it is tagged for
+// Space Complexity: O(cells * k + NUM_GOALS * n)
+int buildTable(const NpcatFile *cat, int k, TableBuilder *b) {
+    const NpcatHeader *h = cat->header;
+    int n = (int)h->numFoods;
+    memset(b, 0, sizeof(TableBuilder));
+
+    NprecHeader *out = &b->header;
+    memcpy(out->magic, NPREC_MAGIC, 8);
+    out->version = NPREC_VERSION;
+    out->headerSize = sizeof(NprecHeader);
+    out->catalogueSize = h->fileSize;
+    out->numFoods = h->numFoods;
+    out->numGoals = h->numGoals;
+    out->numDietTypes = h->numDietTypes;
+    out->numBudgets = h->numBudgets;
+    out->numMealTimes = h->numMealTimes;
+    out->numCells = h->numGoals * h->numDietTypes * h->numBudgets * h->numMealTimes;
+    out->k = (uint32_t)k;
+
+    size_t cellCount = out->numCells;
+    b->counts = (uint8_t*)calloc(cellCount > 0 ? cellCount : 1, 1);
+    b->entries = (ScoredRow*)calloc(cellCount * k > 0 ? cellCount * k : 1, sizeof(ScoredRow));
+    b->cells = (TopKSelector*)malloc((cellCount > 0 ? cellCount : 1) * sizeof(TopKSelector));
+    int *matrix = (int*)malloc(((size_t)NUM_GOALS * n > 0 ? (size_t)NUM_GOALS * n : 1) * sizeof(int));
+    if (b->counts == NULL || b->entries == NULL || b->cells == NULL || matrix == NULL) {
+        printf("❌ Out of memory building recommendation table\n");
+        free(matrix);
+        return -1;
+    }
+    for (size_t c = 0; c < cellCount; c++) {
+        initTopKIn(&b->cells[c], b->entries + c * k, k);
+    }
+
+    // Catalogue goal tag -> scoring rule, resolved once
+    Goal rule[NPCAT_MAX_TAGS];
+    for (uint32_t g = 0; g < h->numGoals; g++) {
+        rule[g] = parseGoal(npcatText(cat, NPCAT_GOAL_NAMES, g));
+    }
+
+    const int32_t *calories = (const int32_t*)npcatSection(cat, NPCAT_FOOD_CALORIES);
+    const float *protein = (const float*)npcatSection(cat, NPCAT_FOOD_PROTEIN);
+    const float *carbs = (const float*)npcatSection(cat, NPCAT_FOOD_CARBS);
+    const uint8_t *diet = (const uint8_t*)npcatSection(cat, NPCAT_FOOD_DIET);
+    const uint8_t *goals = (const uint8_t*)npcatSection(cat, NPCAT_FOOD_GOALS);
+    const uint8_t *mealTimes = (const uint8_t*)npcatSection(cat, NPCAT_FOOD_MEAL_TIMES);
+    const uint8_t *budgets = (const uint8_t*)npcatSection(cat, NPCAT_FOOD_BUDGETS);
+
+    scoreAllGoals(calories, protein, carbs, n, matrix);
+
+    for (int row = 0; row < n; row++) {
+        if (diet[row] >= h->numDietTypes) continue;
+        for (uint32_t g = 0; g < h->numGoals; g++) {
+            if (!(goals[row] >> g & 1)) continue;
+            int score = matrix[(size_t)rule[g] * n + row];
+            for (uint32_t bu = 0; bu < h->numBudgets; bu++) {
+                if (!(budgets[row] >> bu & 1)) continue;
+                size_t base = ((size_t)(g * h->numDietTypes + diet[row]) * h->numBudgets + bu) * h->numMealTimes;
+                for (uint32_t t = 0; t < h->numMealTimes; t++) {
+                    if (mealTimes[row] >> t & 1) offerTopK(&b->cells[base + t], score, (uint32_t)row);
+                }
+            }
+        }
+    }
+
+    for (size_t c = 0; c < cellCount; c++) {
+        b->counts[c] = (uint8_t)sortTopK(&b->cells[c]);
+    }
+    free(matrix);
+    return 0;
+}
+
+size_t alignUp(size_t value) {
+    return (value + NPREC_ALIGN - 1) / NPREC_ALIGN * NPREC_ALIGN;
+}
+
+// Write header + aligned sections to a temp file and rename over path
+int writeTable(TableBuilder *b, const char *path) {
+    NprecHeader *h = &b->header;
+    size_t countsSize = h->numCells;
+    size_t entriesSize = (size_t)h->numCells * h->k * sizeof(NprecEntry);
+    h->countsOffset = alignUp(sizeof(NprecHeader));
+    h->entriesOffset = alignUp(h->countsOffset + countsSize);
+    h->fileSize = alignUp(h->entriesOffset + entriesSize);
+
+    char tmpPath[512];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+    FILE *fp = fopen(tmpPath, "wb");
+    if (fp == NULL) {
+        printf("❌ Cannot write %s\n", tmpPath);
+        return -1;
+    }
+
+    static const uint8_t zeros[NPREC_ALIGN] = {0};
+    size_t written = fwrite(h, 1, sizeof(NprecHeader), fp);
+    written += fwrite(zeros, 1, h->countsOffset - sizeof(NprecHeader), fp);
+    written += fwrite(b->counts, 1, countsSize, fp);
+    written += fwrite(zeros, 1, h->entriesOffset - (h->countsOffset + countsSize), fp);
+    written += fwrite(b->entries, 1, entriesSize, fp);
+    written += fwrite(zeros, 1, h->fileSize - (h->entriesOffset + entriesSize), fp);
+
+    if (fclose(fp) != 0 || written != h->fileSize || rename(tmpPath, path) != 0) {
+        printf("❌ Failed writing %s\n", path);
+        remove(tmpPath);
+        return -1;
+    }
+    return 0;
+}
+
+void freeTableBuilder(TableBuilder *b) {
+    free(b->counts);
+    free(b->entries);
+    free(b->cells);
+    memset(b, 0, sizeof(TableBuilder));
+}
+
+// ================= SERVING =================
+
+// Table must come from this exact catalogue, otherwise row ids are meaningless
+int tableMatchesCatalogue(const NprecFile *table, const NpcatFile *cat) {
+    return table->header->catalogueSize == cat->header->fileSize &&
+           table->header->numFoods == cat->header->numFoods &&
+           table->header->numGoals == cat->header->numGoals &&
+           table->header->numDietTypes == cat->header->numDietTypes &&
+           table->header->numBudgets == cat->header->numBudgets &&
+           table->header->numMealTimes == cat->header->numMealTimes;
+}
+
+// Serve one recommendation by tag names (what meals.html stores in localStorage)
+void printRecommendation(const NprecFile *table, const NpcatFile *cat, const char *goal,
+                         const char *diet, const char *budget, const char *time) {
+    int count;
+    const NprecEntry *best = nprecLookup(table,
+                                         npcatTagIndex(cat, NPCAT_GOAL_NAMES, goal),
+                                         npcatTagIndex(cat, NPCAT_DIET_NAMES, diet),
+                                         npcatTagIndex(cat, NPCAT_BUDGET_NAMES, budget),
+                                         npcatTagIndex(cat, NPCAT_MEAL_TIME_NAMES, time), &count);
+    const int32_t *calories = (const int32_t*)npcatSection(cat, NPCAT_FOOD_CALORIES);
+    const float *protein = (const float*)npcatSection(cat, NPCAT_FOOD_PROTEIN);
+
+    printf("\n--- %s / %s / %s budget / %s ---\n", goal, diet, budget, time);
+    if (count == 0) {
+        printf("  (no matching foods)\n");
+        return;
+    }
+    for (int i = 0; i < count; i++) {
+        uint32_t row = best[i].rowId;
+        printf("  %d. %s %-28s score %4d | %d kcal | %.1fg protein\n", i + 1,
+               npcatText(cat, NPCAT_FOOD_ICON, row), npcatText(cat, NPCAT_FOOD_NAME, row),
+               best[i].score, calories[row], protein[row]);
+    }
+}
+
+// ================= BENCHMARK =================
+
+// Per-request path the table replaces: filter the catalogue by tags, score
+// the matches and sort them; returns the top row id (or -1)
+int filterAndSort(const NpcatFile *cat, int goal, int dietCode, int budget, int time, ScoredRow *scratch) {
+    const NpcatHeader *h = cat->header;
+    const int32_t *calories = (const int32_t*)npcatSection(cat, NPCAT_FOOD_CALORIES);
+    const float *protein = (const float*)npcatSection(cat, NPCAT_FOOD_PROTEIN);
+    const float *carbs = (const float*)npcatSection(cat, NPCAT_FOOD_CARBS);
+    const uint8_t *diet = (const uint8_t*)npcatSection(cat, NPCAT_FOOD_DIET);
+    const uint8_t *goals = (const uint8_t*)npcatSection(cat, NPCAT_FOOD_GOALS);
+    const uint8_t *mealTimes = (const uint8_t*)npcatSection(cat, NPCAT_FOOD_MEAL_TIMES);
+    const uint8_t *budgets = (const uint8_t*)npcatSection(cat, NPCAT_FOOD_BUDGETS);
+    Goal rule = parseGoal(npcatText(cat, NPCAT_GOAL_NAMES, (uint32_t)goal));
+
+    int matches = 0;
+    for (uint32_t row = 0; row < h->numFoods; row++) {
+        if (diet[row] != dietCode || !(goals[row] >> goal & 1) ||
+            !(budgets[row] >> budget & 1) || !(mealTimes[row] >> time & 1)) {
+            continue;
+        }
+        scratch[matches].score = scoreMeal(rule, calories[row], protein[row], carbs[row]);
+        scratch[matches].rowId = row;
+        matches++;
+    }
+    qsort(scratch, matches, sizeof(ScoredRow), compareScoredRows);
+    return matches > 0 ? (int)scratch[0].rowId : -1;
+}
+
+void benchmarkServing(const NprecFile *table, const NpcatFile *cat, int requests) {
+    const NprecHeader *h = table->header;
+    int *cells = (int*)malloc(requests * 4 * sizeof(int));
+    ScoredRow *scratch = (ScoredRow*)malloc((cat->header->numFoods + 1) * sizeof(ScoredRow));
+
+    srand(10);
+    for (int i = 0; i < requests; i++) {
+        cells[4 * i] = rand() % h->numGoals;
+        cells[4 * i + 1] = rand() % h->numDietTypes;
+        cells[4 * i + 2] = rand() % h->numBudgets;
+        cells[4 * i + 3] = rand() % h->numMealTimes;
+    }
+
+    clock_t start = clock();
+    long long sortChecksum = 0;
+    for (int i = 0; i < requests; i++) {
+        sortChecksum += filterAndSort(cat, cells[4 * i], cells[4 * i + 1], cells[4 * i + 2],
+                                      cells[4 * i + 3], scratch);
+    }
+    double sortMs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+    start = clock();
+    long long tableChecksum = 0;
+    for (int i = 0; i < requests; i++) {
+        int count;
+        const NprecEntry *best = nprecLookup(table, cells[4 * i], cells[4 * i + 1],
+                                             cells[4 * i + 2], cells[4 * i + 3], &count);
+        tableChecksum += count > 0 ? (int)best[0].rowId : -1;
+    }
+    double tableMs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+    printf("\n=== BENCHMARK: %d random recommendation requests ===\n", requests);
+    printf("Filter + score + sort : %8.1f ms\n", sortMs);
+    printf("Precomputed table     : %8.1f ms\n", tableMs);
+    printf("Same top picks: %s\n", sortChecksum == tableChecksum ? "Yes" : "No");
+
+    free(cells);
+    free(scratch);
+}
+
+// ================= CORRUPT-FILE TEST =================
+
+// Write size bytes of data to path
+int writeBytes(const char *path, const void *data, size_t size) {
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL) return -1;
+    size_t written = fwrite(data, 1, size, fp);
+    return fclose(fp) == 0 && written == size ? 0 : -1;
+}
+
+// Damage a copy of a good table in one way and check nprecOpen rejects
+// it. Returns 1 if it was rejected
+int rejectsCorruption(const char *label, const uint8_t *good, size_t size, const char *path,
+                      void (*damage)(uint8_t *copy)) {
+    uint8_t *copy = (uint8_t*)malloc(size);
+    if (copy == NULL) return 0;
+    memcpy(copy, good, size);
+    damage(copy);
+    NprecFile table;
+    int rejected = writeBytes(path, copy, size) == 0 && nprecOpen(path, &table) != 0;
+    if (!rejected) nprecClose(&table);
+    printf("%s %s\n", rejected ? "✅ rejected:" : "❌ accepted:", label);
+    free(copy);
+    return rejected;
+}
+
+void countAboveK(uint8_t *copy) {
+    NprecHeader *h = (NprecHeader*)copy;
+    copy[h->countsOffset] = (uint8_t)(h->k + 1);
+}
+
+void rowIdPastCatalogue(uint8_t *copy) {
+    NprecHeader *h = (NprecHeader*)copy;
+    for (uint32_t c = 0; c < h->numCells; c++) {
+        if (copy[h->countsOffset + c] == 0) continue;
+        NprecEntry *first = (NprecEntry*)(copy + h->entriesOffset) + (size_t)c * h->k;
+        first->rowId = h->numFoods;
+        return;
+    }
+}
+
+void hugeK(uint8_t *copy) {
+    ((NprecHeader*)copy)->k = 0x80000001u;  // cells * k * 8 would wrap
+}
+
+void tooManyGoals(uint8_t *copy) {
+    NprecHeader *h = (NprecHeader*)copy;
+    h->numGoals = 0x10000;
+    h->numCells = h->numGoals * h->numDietTypes * h->numBudgets * h->numMealTimes;
+}
+
+// Every damaged copy of path must be refused
+int corruptFileTest(const char *path) {
+    printf("\n=== CORRUPT-FILE TEST ===\n");
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) return 0;
+    fseek(fp, 0, SEEK_END);
+    size_t size = (size_t)ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    uint8_t *good = (uint8_t*)malloc(size);
+    int ok = good != NULL && fread(good, 1, size, fp) == size;
+    fclose(fp);
+    if (!ok) {
+        free(good);
+        return 0;
+    }
+
+    char damaged[512];
+    snprintf(damaged, sizeof(damaged), "%s.corrupt", path);
+    ok &= rejectsCorruption("cell count larger than k", good, size, damaged, countAboveK);
+    ok &= rejectsCorruption("row id past the catalogue", good, size, damaged, rowIdPastCatalogue);
+    ok &= rejectsCorruption("k large enough to wrap the size check", good, size, damaged, hugeK);
+    ok &= rejectsCorruption("more goals than NPREC_MAX_TAGS", good, size, damaged, tooManyGoals);
+    remove(damaged);
+    free(good);
+    return ok;
+}
+
+// Usage: recommendation_table [catalogue.npcat] [recommendations.nprec] [k]
+int main(int argc, char **argv) {
+    const char *cataloguePath = argc > 1 ? argv[1] : "catalogue.npcat";
+    const char *tablePath = argc > 2 ? argv[2] : "recommendations.nprec";
+    int k = argc > 3 ? atoi(argv[3]) : DEFAULT_K;
+    if (k < 1 || k > NPREC_MAX_K) {
+        printf("❌ k must be between 1 and %d\n", NPREC_MAX_K);
+        return 1;
+    }
+
+    printf("\n=== NutriPlan Recommendation Table (goal x diet x budget x mealTime) ===\n\n");
+
+    NpcatFile cat;
+    if (npcatOpen(cataloguePath, &cat) != 0) {
+        printf("   Run catalogue_compiler first to build %s\n", cataloguePath);
+        return 1;
+    }
+
+    clock_t start = clock();
+    TableBuilder builder;
+    if (buildTable(&cat, k, &builder) != 0 || writeTable(&builder, tablePath) != 0) {
+        freeTableBuilder(&builder);
+        npcatClose(&cat);
+        return 1;
+    }
+    double buildMs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+    int filled = 0;
+    for (uint32_t c = 0; c < builder.header.numCells; c++) filled += builder.counts[c] > 0;
+    printf("✅ Built %s in %.2f ms: %u cells (%u goals x %u diets x %u budgets x %u times), "
+           "top %d each, %d non-empty, %llu bytes\n",
+           tablePath, buildMs, builder.header.numCells, builder.header.numGoals,
+           builder.header.numDietTypes, builder.header.numBudgets, builder.header.numMealTimes,
+           k, filled, (unsigned long long)builder.header.fileSize);
+    freeTableBuilder(&builder);
+
+    NprecFile table;
+    if (nprecOpen(tablePath, &table) != 0) {
+        npcatClose(&cat);
+        return 1;
+    }
+    if (!tableMatchesCatalogue(&table, &cat)) {
+        printf("❌ %s was built from a different catalogue\n", tablePath);
+        nprecClose(&table);
+        npcatClose(&cat);
+        return 1;
+    }
+
+    // meals.html defaults, then a few other selections
+    printRecommendation(&table, &cat, "weight-loss", "veg", "low", "morning");
+    printRecommendation(&table, &cat, "muscle-gain", "non-veg", "low", "afternoon");
+    printRecommendation(&table, &cat, "pcod", "veg", "low", "evening");
+    printRecommendation(&table, &cat, "eat-better", "veg", "moderate", "evening");
+
+    benchmarkServing(&table, &cat, 1000000);
+
+    nprecClose(&table);
+    npcatClose(&cat);
+    int corruptOk = corruptFileTest(tablePath);
+    printf("\n=== Recommendations served with one table read per request ===\n\n");
+    return corruptOk ? 0 : 1;
+}
@@ -0,0 +1,584 @@
+// Nutrient-Similarity Graph Builder (k nearest neighbours)
+// NutriPlan - Data Structures Project
+// Computes the substitution links that graph.c wires by hand: every food is
+// connected to its k nearest diet-compatible foods in (calories, protein,
+// carbs, fats, cost) space. Features are z-score normalised so calories do
+// not drown out grams, neighbours come from a 5-d k-d tree (bounding box +
+// OR'd diet mask pruning, as in kd_tree.c) and queries run on a pthread pool.
+// Output is an edge list in csr_graph.c's format, ready for buildCsr.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <float.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "catalogue_format.h"
+#include "string_pool.h"   // DietType, DIET_MASK_*, parseDietType
+
+#define SIM_DIMS 5          // calories, protein, carbs, fats, cost
+#define SIM_LEAF_SIZE 8
+#define SIM_MAX_K 32
+#define QUERY_CHUNK 256     // foods claimed per worker step
+#define MAX_THREADS 64
+
+// Raw nutrient vector of one food
+typedef struct {
+    float calories;
+    float protein;
+    float carbs;
+    float fats;
+    float cost;
+    uint8_t diet;
+} NutrientRow;
+
+// Normalised point stored in the tree
+typedef struct {
+    float key[SIM_DIMS];
+    uint32_t rowId;
+    uint8_t diet;
+} SimPoint;
+
+typedef struct {
+    float min[SIM_DIMS];
+    float max[SIM_DIMS];
+    int lo;        // points[lo..hi) belong to this subtree
+    int hi;
+    int left;      // child node ids, -1 for a leaf
+    int right;
+    uint8_t diet;  // OR of the subtree's diet bits
+} SimNode;
+
+typedef struct {
+    SimPoint *points;
+    SimNode *nodes;
+    int numPoints;
+    int numNodes;
+} SimIndex;
+
+// One candidate neighbour
+typedef struct {
+    float dist;      // squared distance in normalised space
+    uint32_t rowId;
+} Neighbour;
+
+// k nearest compatible neighbours of every food, row-major [n][k];
+// count[i] <= k when fewer compatible foods exist
+typedef struct {
+    Neighbour *neighbours;
+    uint8_t *count;
+    int n;
+    int k;
+} KnnTable;
+
+// Undirected substitution link (csr_graph.c's Edge)
+typedef struct {
+    uint32_t from;
+    uint32_t to;
+} Edge;
+
+// Diet bit of a food's diet name; 0 for unknown names (and "all")
+uint8_t dietMaskOf(const char *dietType) {
+    int diet = parseDietType(dietType);
+    return diet == DIET_UNKNOWN || diet == DIET_ANY ? 0 : (uint8_t)(1u << diet);
+}
+
+// Diets a food may be swapped for: vegetarians keep to veg, egg eaters
+// also take veg, non-veg takes anything; unknown diets (0) match nothing
+uint8_t compatibleDiets(uint8_t diet) {
+    switch (diet) {
+        case DIET_MASK_VEG: return DIET_MASK_VEG;
+        case DIET_MASK_EGG: return DIET_MASK_VEG | DIET_MASK_EGG;
+        case DIET_MASK_NON_VEG: return DIET_MASK_VEG | DIET_MASK_EGG | DIET_MASK_NON_VEG;
+        default: return 0;
+    }
+}
+
+// ================= FEATURES =================
+
+// z-score every dimension; constant dimensions map to 0
+// Time Complexity: O(n)
+void normaliseRows(const NutrientRow *rows, int n, SimPoint *points) {
+    double mean[SIM_DIMS] = {0}, sq[SIM_DIMS] = {0};
+    for (int i = 0; i < n; i++) {
+        const float v[SIM_DIMS] = { rows[i].calories, rows[i].protein, rows[i].carbs,
+                                    rows[i].fats, rows[i].cost };
+        for (int d = 0; d < SIM_DIMS; d++) {
+            mean[d] += v[d];
+            sq[d] += (double)v[d] * v[d];
+        }
+    }
+    float scale[SIM_DIMS];
+    for (int d = 0; d < SIM_DIMS; d++) {
+        mean[d] = n > 0 ? mean[d] / n : 0;
+        double var = n > 0 ? sq[d] / n - mean[d] * mean[d] : 0;
+        scale[d] = var > 1e-12 ? (float)(1.0 / sqrt(var)) : 0.0f;
+    }
+    for (int i = 0; i < n; i++) {
+        const float v[SIM_DIMS] = { rows[i].calories, rows[i].protein, rows[i].carbs,
+                                    rows[i].fats, rows[i].cost };
+        for (int d = 0; d < SIM_DIMS; d++) {
+            points[i].key[d] = (float)((v[d] - mean[d]) * scale[d]);
+        }
+        points[i].rowId = (uint32_t)i;
+        points[i].diet = rows[i].diet;
+    }
+}
+
+// ================= BUILD =================
+
+// Partition points[lo..hi) so points[k] holds the k-th smallest value on dim
+// Time Complexity: O(n) average (quickselect)
+void selectKth(SimPoint *points, int lo, int hi, int k, int dim) {
+    while (hi - lo > 1) {
+        float pivot = points[lo + (hi - lo) / 2].key[dim];
+        int i = lo, j = hi - 1;
+        while (i <= j) {
+            while (points[i].key[dim] < pivot) i++;
+            while (points[j].key[dim] > pivot) j--;
+            if (i <= j) {
+                SimPoint tmp = points[i];
+                points[i] = points[j];
+                points[j] = tmp;
+                i++;
+                j--;
+            }
+        }
+        if (k <= j) hi = j + 1;
+        else if (k >= i) lo = i;
+        else return;
+    }
+}
+
+// Recursively build the subtree over points[lo..hi), returns its node id
+// Time Complexity: O(n log n)
+int buildNode(SimIndex *index, int lo, int hi) {
+    int id = index->numNodes++;
+    SimNode *node = &index->nodes[id];
+    node->lo = lo;
+    node->hi = hi;
+    node->left = -1;
+    node->right = -1;
+    node->diet = 0;
+
+    for (int d = 0; d < SIM_DIMS; d++) {
+        node->min[d] = FLT_MAX;
+        node->max[d] = -FLT_MAX;
+    }
+    for (int i = lo; i < hi; i++) {
+        const SimPoint *p = &index->points[i];
+        for (int d = 0; d < SIM_DIMS; d++) {
+            if (p->key[d] < node->min[d]) node->min[d] = p->key[d];
+            if (p->key[d] > node->max[d]) node->max[d] = p->key[d];
+        }
+        node->diet |= p->diet;
+    }
+
+    if (hi - lo <= SIM_LEAF_SIZE) return id;
+
+    int dim = 0;
+    for (int d = 1; d < SIM_DIMS; d++) {
+        if (node->max[d] - node->min[d] > node->max[dim] - node->min[dim]) dim = d;
+    }
+    int mid = lo + (hi - lo) / 2;
+    selectKth(index->points, lo, hi, mid, dim);
+
+    node->left = buildNode(index, lo, mid);
+    node->right = buildNode(index, mid, hi);
+    return id;
+}
+
+int buildSimIndex(SimIndex *index, const SimPoint *points, int n) {
+    index->numPoints = n;
+    index->numNodes = 0;
+    index->points = (SimPoint*)malloc((n > 0 ? n : 1) * sizeof(SimPoint));
+    index->nodes = (SimNode*)malloc((2 * n + 1) * sizeof(SimNode));
+    if (index->points == NULL || index->nodes == NULL) {
+        printf("❌ Out of memory building similarity index\n");
+        return -1;
+    }
+    memcpy(index->points, points, n * sizeof(SimPoint));
+    if (n > 0) buildNode(index, 0, n);
+    return 0;
+}
+
+void freeSimIndex(SimIndex *index) {
+    free(index->points);
+    free(index->nodes);
+    index->points = NULL;
+    index->nodes = NULL;
+    index->numPoints = index->numNodes = 0;
+}
+
+// ================= k-NN QUERY =================
+
+// Closer wins; equal distances go to the lower row id so results are
+// deterministic and match a brute-force scan exactly
+int closer(Neighbour a, Neighbour b) {
+    return a.dist < b.dist || (a.dist == b.dist && a.rowId < b.rowId);
+}
+
+// Bounded max-heap of the k best candidates (root = current worst)
+typedef struct {
+    Neighbour heap[SIM_MAX_K];
+    int size;
+    int k;
+} KnnHeap;
+
+void offerNeighbour(KnnHeap *h, Neighbour cand) {
+    int index;
+    if (h->size < h->k) {
+        index = h->size++;
+        while (index > 0) {
+            int parent = (index - 1) / 2;
+            if (!closer(h->heap[parent], cand)) break;
+            h->heap[index] = h->heap[parent];
+            index = parent;
+        }
+        h->heap[index] = cand;
+        return;
+    }
+    if (!closer(cand, h->heap[0])) return;
+    index = 0;
+    while (1) {
+        int child = 2 * index + 1;
+        if (child >= h->size) break;
+        if (child + 1 < h->size && closer(h->heap[child], h->heap[child + 1])) child++;
+        if (!closer(cand, h->heap[child])) break;
+        h->heap[index] = h->heap[child];
+        index = child;
+    }
+    h->heap[index] = cand;
+}
+
+// Copy heap contents to out[], nearest first (insertion sort, k is small)
+int sortNeighbours(const Neighbour *heap, int count, Neighbour *out) {
+    for (int i = 0; i < count; i++) {
+        Neighbour cand = heap[i];
+        int j = i;
+        while (j > 0 && closer(cand, out[j - 1])) {
+            out[j] = out[j - 1];
+            j--;
+        }
+        out[j] = cand;
+    }
+    return count;
+}
+
+float squaredDistance(const float *a, const float *b) {
+    float sum = 0;
+    for (int d = 0; d < SIM_DIMS; d++) {
+        float diff = a[d] - b[d];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+// Squared distance from q to the node's bounding box (0 if inside)
+float boxDistance(const SimNode *node, const float *q) {
+    float sum = 0;
+    for (int d = 0; d < SIM_DIMS; d++) {
+        float diff = q[d] < node->min[d] ? node->min[d] - q[d] :
+                     q[d] > node->max[d] ? q[d] - node->max[d] : 0.0f;
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+// Depth-first search visiting the nearer child first; a subtree is skipped
+// when its box is farther than the current k-th best or holds no
+// compatible diet
+void searchNode(const SimIndex *index, int id, const float *q, uint32_t self,
+                uint8_t dietMask, KnnHeap *h) {
+    const SimNode *node = &index->nodes[id];
+    if (!(node->diet & dietMask)) return;
+    if (h->size == h->k && boxDistance(node, q) > h->heap[0].dist) return;
+
+    if (node->left < 0) {
+        for (int i = node->lo; i < node->hi; i++) {
+            const SimPoint *p = &index->points[i];
+            if (p->rowId == self || !(p->diet & dietMask)) continue;
+            Neighbour cand = { squaredDistance(q, p->key), p->rowId };
+            offerNeighbour(h, cand);
+        }
+        return;
+    }
+
+    int first = node->left, second = node->right;
+    if (boxDistance(&index->nodes[second], q) < boxDistance(&index->nodes[first], q)) {
+        first = node->right;
+        second = node->left;
+    }
+    searchNode(index, first, q, self, dietMask, h);
+    searchNode(index, second, q, self, dietMask, h);
+}
+
+// Write the k nearest compatible neighbours of point p into out[], nearest
+// first; returns how many were found
+// Time Complexity: O(k log k + log n) expected for well spread data
+int nearestNeighbours(const SimIndex *index, const SimPoint *p, int k, Neighbour *out) {
+    KnnHeap h;
+    h.size = 0;
+    h.k = k;
+    if (index->numNodes > 0) {
+        searchNode(index, 0, p->key, p->rowId, compatibleDiets(p->diet), &h);
+    }
+    return sortNeighbours(h.heap, h.size, out);
+}
+
+// ================= PARALLEL BUILD =================
+
+typedef struct {
+    const SimIndex *index;
+    const SimPoint *queries;  // original row order
+    KnnTable *table;
+    int next;                 // next unclaimed row, advanced atomically
+} KnnJob;
+
+void* knnWorker(void *arg) {
+    KnnJob *job = (KnnJob*)arg;
+    KnnTable *t = job->table;
+    while (1) {
+        int start = __atomic_fetch_add(&job->next, QUERY_CHUNK, __ATOMIC_RELAXED);
+        if (start >= t->n) break;
+        int end = start + QUERY_CHUNK < t->n ? start + QUERY_CHUNK : t->n;
+        for (int i = start; i < end; i++) {
+            t->count[i] = (uint8_t)nearestNeighbours(job->index, &job->queries[i], t->k,
+                                                     t->neighbours + (size_t)i * t->k);
+        }
+    }
+    return NULL;
+}
+
+void freeKnnTable(KnnTable *table) {
+    free(table->neighbours);
+    free(table->count);
+    memset(table, 0, sizeof(KnnTable));
+}
+
+// Compute the k-NN table for all foods using numThreads workers
+// Returns 0 on success, -1 on error (table left empty)
+// Time Complexity: O(n log n) build + O(n (k log k + log n)) queries, split across threads
+// Space Complexity: O(n k)
+int buildKnnTable(const NutrientRow *rows, int n, int k, int numThreads, KnnTable *table) {
+    if (k < 1 || k > SIM_MAX_K) {
+        printf("❌ k must be between 1 and %d\n", SIM_MAX_K);
+        return -1;
+    }
+    if (numThreads < 1) numThreads = 1;
+    if (numThreads > MAX_THREADS) numThreads = MAX_THREADS;
+
+    SimPoint *points = (SimPoint*)malloc((n > 0 ? n : 1) * sizeof(SimPoint));
+    table->neighbours = (Neighbour*)malloc(((size_t)n * k > 0 ? (size_t)n * k : 1) * sizeof(Neighbour));
+    table->count = (uint8_t*)calloc(n > 0 ? n : 1, 1);
+    table->n = n;
+    table->k = k;
+    SimIndex index;
+    memset(&index, 0, sizeof(index));
+    if (points == NULL || table->neighbours == NULL || table->count == NULL) {
+        printf("❌ Out of memory building k-NN table\n");
+        free(points);
+        freeKnnTable(table);
+        return -1;
+    }
+    normaliseRows(rows, n, points);
+    if (buildSimIndex(&index, points, n) != 0) {
+        free(points);
+        freeSimIndex(&index);
+        freeKnnTable(table);
+        return -1;
+    }
+
+    KnnJob job = { &index, points, table, 0 };
+    pthread_t threads[MAX_THREADS];
+    int started = 0;
+    for (int t = 1; t < numThreads; t++) {
+        if (pthread_create(&threads[started], NULL, knnWorker, &job) == 0) started++;
+    }
+    knnWorker(&job);  // calling thread works too
+    for (int t = 0; t < started; t++) pthread_join(threads[t], NULL);
+
+    free(points);
+    freeSimIndex(&index);
+    return 0;
+}
+
+// Emit one undirected link per neighbour pair (a link found from both
+// ends is written once); returns the number of edges written to out.
+// A link is diet-compatible for the food that found it, so like graph.c's
+// egg <-> paneer link, the veg end must still filter swaps by diet.
+// out needs room for n * k edges
+// Time Complexity: O(n k^2)
+size_t knnEdges(const KnnTable *table, Edge *out) {
+    size_t count = 0;
+    for (int i = 0; i < table->n; i++) {
+        const Neighbour *row = table->neighbours + (size_t)i * table->k;
+        for (int j = 0; j < table->count[i]; j++) {
+            uint32_t other = row[j].rowId;
+            int duplicate = 0;
+            if (other < (uint32_t)i) {  // already emitted from the other end?
+                const Neighbour *back = table->neighbours + (size_t)other * table->k;
+                for (int m = 0; m < table->count[other]; m++) {
+                    if (back[m].rowId == (uint32_t)i) duplicate = 1;
+                }
+            }
+            if (!duplicate) {
+                out[count].from = (uint32_t)i;
+                out[count].to = other;
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+// ================= DEMO AND BENCHMARK =================
+
+double elapsedMs(struct timespec start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start.tv_sec) * 1000.0 + (now.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+int defaultThreads(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus < 1 ? 1 : cpus > MAX_THREADS ? MAX_THREADS : (int)cpus;
+}
+
+// Link the real catalogue and print every food's substitutes
+void demoCatalogue(const char *path, int k) {
+    NpcatFile cat;
+    if (npcatOpen(path, &cat) != 0) {
+        printf("   Run catalogue_compiler first to build %s\n", path);
+        return;
+    }
+    int n = (int)cat.header->numFoods;
+    const int32_t *calories = (const int32_t*)npcatSection(&cat, NPCAT_FOOD_CALORIES);
+    const float *protein = (const float*)npcatSection(&cat, NPCAT_FOOD_PROTEIN);
+    const float *carbs = (const float*)npcatSection(&cat, NPCAT_FOOD_CARBS);
+    const float *fats = (const float*)npcatSection(&cat, NPCAT_FOOD_FATS);
+    const int32_t *cost = (const int32_t*)npcatSection(&cat, NPCAT_FOOD_COST);
+    const uint8_t *diet = (const uint8_t*)npcatSection(&cat, NPCAT_FOOD_DIET);
+
+    NutrientRow *rows = (NutrientRow*)malloc((n > 0 ? n : 1) * sizeof(NutrientRow));
+    for (int i = 0; i < n; i++) {
+        rows[i].calories = (float)calories[i];
+        rows[i].protein = protein[i];
+        rows[i].carbs = carbs[i];
+        rows[i].fats = fats[i];
+        rows[i].cost = (float)cost[i];
+        rows[i].diet = dietMaskOf(npcatText(&cat, NPCAT_DIET_NAMES, diet[i]));
+    }
+
+    KnnTable table;
+    if (buildKnnTable(rows, n, k, defaultThreads(), &table) == 0) {
+        printf("--- %d NEAREST SUBSTITUTES PER FOOD (%s) ---\n", k, path);
+        for (int i = 0; i < n; i++) {
+            printf("%-26s [%-7s] → ", npcatText(&cat, NPCAT_FOOD_NAME, i),
+                   npcatText(&cat, NPCAT_DIET_NAMES, diet[i]));
+            for (int j = 0; j < table.count[i]; j++) {
+                printf("%s%s", j > 0 ? ", " : "",
+                       npcatText(&cat, NPCAT_FOOD_NAME, table.neighbours[(size_t)i * k + j].rowId));
+            }
+            printf("\n");
+        }
+        Edge *edges = (Edge*)malloc(((size_t)n * k > 0 ? (size_t)n * k : 1) * sizeof(Edge));
+        printf("✅ %zu undirected substitution links generated\n", knnEdges(&table, edges));
+        free(edges);
+        freeKnnTable(&table);
+    }
+    free(rows);
+    npcatClose(&cat);
+}
+
+// Brute-force k-NN of one food for verification
+int bruteForceNeighbours(const SimPoint *points, int n, int query, int k, Neighbour *out) {
+    KnnHeap h;
+    h.size = 0;
+    h.k = k;
+    uint8_t mask = compatibleDiets(points[query].diet);
+    for (int i = 0; i < n; i++) {
+        if (i == query || !(points[i].diet & mask)) continue;
+        Neighbour cand = { squaredDistance(points[query].key, points[i].key), (uint32_t)i };
+        offerNeighbour(&h, cand);
+    }
+    return sortNeighbours(h.heap, h.size, out);
+}
+
+void benchmarkKnn(int n, int k, int samples) {
+    NutrientRow *rows = (NutrientRow*)malloc(n * sizeof(NutrientRow));
+    const uint8_t diets[] = { DIET_MASK_VEG, DIET_MASK_VEG, DIET_MASK_EGG, DIET_MASK_NON_VEG };
+    srand(12);
+    for (int i = 0; i < n; i++) {
+        rows[i].calories = (float)(80 + rand() % 700);
+        rows[i].protein = (float)(rand() % 450) / 10.0f;
+        rows[i].carbs = (float)(rand() % 900) / 10.0f;
+        rows[i].fats = (float)(rand() % 350) / 10.0f;
+        rows[i].cost = (float)(10 + rand() % 190);
+        rows[i].diet = diets[rand() % 4];
+    }
+
+    int threads = defaultThreads();
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    KnnTable table;
+    if (buildKnnTable(rows, n, k, threads, &table) != 0) {
+        free(rows);
+        return;
+    }
+    double treeMs = elapsedMs(start);
+
+    // All-pairs baseline on a sample, extrapolated to the whole catalogue
+    SimPoint *points = (SimPoint*)malloc(n * sizeof(SimPoint));
+    normaliseRows(rows, n, points);
+    Neighbour expected[SIM_MAX_K];
+    int mismatches = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int s = 0; s < samples; s++) {
+        int query = (int)((long long)s * n / samples);
+        int count = bruteForceNeighbours(points, n, query, k, expected);
+        const Neighbour *got = table.neighbours + (size_t)query * k;
+        if (count != table.count[query]) {
+            mismatches++;
+            continue;
+        }
+        for (int j = 0; j < count; j++) {
+            if (got[j].rowId != expected[j].rowId) {
+                mismatches++;
+                break;
+            }
+        }
+    }
+    double bruteMs = elapsedMs(start) * n / samples;
+
+    Edge *edges = (Edge*)malloc((size_t)n * k * sizeof(Edge));
+    size_t numEdges = knnEdges(&table, edges);
+
+    printf("\n=== BENCHMARK: %d-NN graph over %d foods ===\n", k, n);
+    printf("k-d tree, %d thread(s)       : %10.1f ms\n", threads, treeMs);
+    printf("All-pairs (est. from %d)    : %10.1f ms\n", samples, bruteMs);
+    printf("Exact match on sampled foods: %s (%d mismatches)\n", mismatches == 0 ? "Yes" : "No", mismatches);
+    printf("Undirected links            : %zu\n", numEdges);
+
+    free(edges);
+    free(points);
+    freeKnnTable(&table);
+    free(rows);
+}
+
+// Build: gcc -O2 -pthread similarity_graph.c -lm
+// Usage: similarity_graph [catalogue.npcat] [k]
+int main(int argc, char **argv) {
+    const char *path = argc > 1 ? argv[1] : "catalogue.npcat";
+    int k = argc > 2 ? atoi(argv[2]) : 3;
+
+    printf("\n=== NutriPlan Nutrient-Similarity Graph (k-NN) ===\n\n");
+    demoCatalogue(path, k);
+    benchmarkKnn(50000, 8, 500);
+
+    printf("\n=== Substitution links computed from nutrition, not hand-wired ===\n\n");
+    return 0;
+}
@@ -5,104 +5,158 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 #include <time.h>
+#include "string_pool.h"
 
-#define MAX_STACK 50
+#define SEGMENT_SIZE 256   // cheat meals per segment
+
+// Junk food names and icons, interned once (multi-byte emoji never overflow)
+StringPool junkNames;
 
 // Cheat meal structure
+// The timestamp and consequence are formatted only when displayed
 typedef struct {
-    char name[50];
-    char icon[10];
+    StringId name;
+    StringId icon;
     int calories;
-    char timestamp[30];
-    char consequence[100];
+    int64_t eatenAt;   // seconds since the epoch
 } CheatMeal;
 
 // Stack structure
+// Grows one fixed-size segment at a time, so pushes never copy old
+// entries and a pointer to an entry stays valid until it is popped
 typedef struct {
-    CheatMeal items[MAX_STACK];
-    int top;
+    CheatMeal **segments;   // segments[i] holds entries [i * SEGMENT_SIZE, ...)
+    int numSegments;        // allocated segments
+    int maxSegments;        // capacity of the segments array
+    long size;
+    long totalCalories;     // running sum, kept by push/pop/clear
 } CheatStack;
 
 // Initialize stack
 // Time Complexity: O(1)
 // Space Complexity: O(1)
 void initStack(CheatStack *stack) {
-    stack->top = -1;
+    stack->segments = NULL;
+    stack->numSegments = 0;
+    stack->maxSegments = 0;
+    stack->size = 0;
+    stack->totalCalories = 0;
 }
 
 // Check if stack is empty
 // Time Complexity: O(1)
 int isEmpty(CheatStack *stack) {
-    return stack->top == -1;
+    return stack->size == 0;
 }
 
-// Check if stack is full
+// Entry at position index (0 = oldest)
 // Time Complexity: O(1)
-int isFull(CheatStack *stack) {
-    return stack->top == MAX_STACK - 1;
+CheatMeal* stackItem(CheatStack *stack, long index) {
+    return &stack->segments[index / SEGMENT_SIZE][index % SEGMENT_SIZE];
 }
 
-// Push cheat meal onto stack
-// Time Complexity: O(1)
-// Space Complexity: O(1)
-void push(CheatStack *stack, char *name, char *icon, int calories) {
-    if (isFull(stack)) {
-        printf("❌ Stack overflow! Too many sins (max 50)\n");
-        return;
+// Push a cheat meal eaten at eatenAt, without printing
+// Returns 0 on success, -1 if out of memory
+// Time Complexity: O(1) amortized
+int pushCheat(CheatStack *stack, char *name, char *icon, int calories, int64_t eatenAt) {
+    if (stack->size == (long)stack->numSegments * SEGMENT_SIZE) {
+        if (stack->numSegments == stack->maxSegments) {
+            int newMax = stack->maxSegments > 0 ? stack->maxSegments * 2 : 4;
+            CheatMeal **grown = (CheatMeal**)realloc(stack->segments, newMax * sizeof(CheatMeal*));
+            if (grown == NULL) {
+                printf("❌ Memory allocation failed!\n");
+                return -1;
+            }
+            stack->segments = grown;
+            stack->maxSegments = newMax;
+        }
+        CheatMeal *segment = (CheatMeal*)malloc(SEGMENT_SIZE * sizeof(CheatMeal));
+        if (segment == NULL) {
+            printf("❌ Memory allocation failed!\n");
+            return -1;
+        }
+        stack->segments[stack->numSegments++] = segment;
     }
     
-    stack->top++;
-    CheatMeal *cheat = &stack->items[stack->top];
-    
-    strcpy(cheat->name, name);
-    strcpy(cheat->icon, icon);
+    CheatMeal *cheat = stackItem(stack, stack->size++);
+    cheat->name = internString(&junkNames, name);
+    cheat->icon = internString(&junkNames, icon);
     cheat->calories = calories;
+    cheat->eatenAt = eatenAt;
+    stack->totalCalories += calories;
+    return 0;
+}
+
+// Push cheat meal onto stack (eaten now)
+// Time Complexity: O(1) amortized
+// Space Complexity: O(1) amortized
+void push(CheatStack *stack, char *name, char *icon, int calories) {
+    if (pushCheat(stack, name, icon, calories, (int64_t)time(NULL)) == 0) {
+        printf("❌ PUSH: %s %s (%d kcal) added to sin stack\n", icon, name, calories);
+    }
+}
+
+// Remove the top entry into *removed, without printing
+// Keeps one empty segment spare so push/pop at a boundary does not thrash
+// Returns 0 on success, -1 if the stack is empty
+// Time Complexity: O(1)
+int popCheat(CheatStack *stack, CheatMeal *removed) {
+    if (stack->size == 0) return -1;
     
-    // Add timestamp
-    time_t now = time(NULL);
-    struct tm *t = localtime(&now);
-    strftime(cheat->timestamp, sizeof(cheat->timestamp), "%Y-%m-%d %H:%M:%S", t);
-    
-    // Generate consequence message
-    int daysDelayed = calories / 500;  // Rough estimate: 500 kcal = 1 day delay
-    sprintf(cheat->consequence, 
-            "🔥 %d kcal = Goal delayed by ~%d day(s)", 
-            calories, daysDelayed);
+    *removed = *stackItem(stack, --stack->size);
+    stack->totalCalories -= removed->calories;
     
-    printf("❌ PUSH: %s %s (%d kcal) added to sin stack\n", icon, name, calories);
+    long usedSegments = (stack->size + SEGMENT_SIZE - 1) / SEGMENT_SIZE;
+    if (stack->numSegments > usedSegments + 1) {
+        free(stack->segments[--stack->numSegments]);
+    }
+    return 0;
 }
 
 // Pop (undo) last cheat meal from stack
 // Time Complexity: O(1)
 // Space Complexity: O(1)
 CheatMeal pop(CheatStack *stack) {
-    CheatMeal empty = {"", "", 0, "", ""};
+    CheatMeal removed = {EMPTY_STRING, EMPTY_STRING, 0, 0};
     
-    if (isEmpty(stack)) {
+    if (popCheat(stack, &removed) != 0) {
         printf("✅ Stack is empty! No sins to undo.\n");
-        return empty;
+        return removed;
     }
     
-    CheatMeal removed = stack->items[stack->top];
-    stack->top--;
-    
     printf("✅ POP: %s %s (%d kcal) removed from stack\n", 
-           removed.icon, removed.name, removed.calories);
+           poolString(&junkNames, removed.icon), poolString(&junkNames, removed.name),
+           removed.calories);
     return removed;
 }
 
 // Peek at top cheat meal without removing
 // Time Complexity: O(1)
 CheatMeal peek(CheatStack *stack) {
-    CheatMeal empty = {"", "", 0, "", ""};
+    CheatMeal empty = {EMPTY_STRING, EMPTY_STRING, 0, 0};
     
     if (isEmpty(stack)) {
         printf("Stack is empty!\n");
         return empty;
     }
     
-    return stack->items[stack->top];
+    return *stackItem(stack, stack->size - 1);
+}
+
+// Local date and time of a cheat meal, e.g. "2025-01-31 21:05:00"
+void formatTimestamp(const CheatMeal *cheat, char *buffer, size_t size) {
+    time_t when = (time_t)cheat->eatenAt;
+    struct tm t;
+    localtime_r(&when, &t);
+    strftime(buffer, size, "%Y-%m-%d %H:%M:%S", &t);
+}
+
+// Consequence message of a cheat meal
+void formatConsequence(const CheatMeal *cheat, char *buffer, size_t size) {
+    int daysDelayed = cheat->calories / 500;  // Rough estimate: 500 kcal = 1 day delay
+    snprintf(buffer, size, "🔥 %d kcal = Goal delayed by ~%d day(s)", cheat->calories, daysDelayed);
 }
 
 // Display entire stack (from top to bottom)
@@ -117,59 +171,141 @@ void displayStack(CheatStack *stack) {
     }
     
     printf("\n📚 ========== YOUR SIN STACK (LIFO) ==========\n");
-    printf("   Total Sins: %d\n", stack->top + 1);
+    printf("   Total Sins: %ld\n", stack->size);
     printf("==============================================\n\n");
     
-    int totalCalories = 0;
+    char timestamp[32];
+    char consequence[100];
     
-    for (int i = stack->top; i >= 0; i--) {
-        CheatMeal *cheat = &stack->items[i];
+    for (long i = stack->size - 1; i >= 0; i--) {
+        CheatMeal *cheat = stackItem(stack, i);
         
-        if (i == stack->top) {
+        if (i == stack->size - 1) {
             printf("🔝 TOP → ");
         } else {
             printf("       ");
         }
         
-        printf("[%s %s - %d kcal]\n", cheat->icon, cheat->name, cheat->calories);
-        printf("         📅 %s\n", cheat->timestamp);
-        printf("         %s\n\n", cheat->consequence);
-        
-        totalCalories += cheat->calories;
+        formatTimestamp(cheat, timestamp, sizeof(timestamp));
+        formatConsequence(cheat, consequence, sizeof(consequence));
+        printf("[%s %s - %d kcal]\n", poolString(&junkNames, cheat->icon),
+               poolString(&junkNames, cheat->name), cheat->calories);
+        printf("         📅 %s\n", timestamp);
+        printf("         %s\n\n", consequence);
     }
     
     printf("⬇ BOTTOM (Oldest sin)\n\n");
-    printf("💀 TOTAL SIN CALORIES: %d kcal\n", totalCalories);
-    printf("⚠  Goal delayed by ~%d days!\n", totalCalories / 500);
+    printf("💀 TOTAL SIN CALORIES: %ld kcal\n", stack->totalCalories);
+    printf("⚠  Goal delayed by ~%ld days!\n", stack->totalCalories / 500);
     printf("==============================================\n\n");
 }
 
 // Get total sin calories
-// Time Complexity: O(n)
-int getTotalSinCalories(CheatStack *stack) {
-    int total = 0;
-    for (int i = 0; i <= stack->top; i++) {
-        total += stack->items[i].calories;
-    }
-    return total;
+// Time Complexity: O(1)
+long getTotalSinCalories(CheatStack *stack) {
+    return stack->totalCalories;
 }
 
 // Get stack size
 // Time Complexity: O(1)
-int getSize(CheatStack *stack) {
-    return stack->top + 1;
+long getSize(CheatStack *stack) {
+    return stack->size;
 }
 
-// Clear all sins from stack
-// Time Complexity: O(1)
+// Clear all sins from stack (keeps the first segment for reuse)
+// Time Complexity: O(segments)
 void clearStack(CheatStack *stack) {
-    stack->top = -1;
+    while (stack->numSegments > 1) {
+        free(stack->segments[--stack->numSegments]);
+    }
+    stack->size = 0;
+    stack->totalCalories = 0;
     printf("🗑  All sins cleared! Fresh start!\n");
 }
 
+// Release every segment
+// Time Complexity: O(segments)
+void freeStack(CheatStack *stack) {
+    for (int i = 0; i < stack->numSegments; i++) {
+        free(stack->segments[i]);
+    }
+    free(stack->segments);
+    initStack(stack);
+}
+
+// ================= BENCHMARK: LONG-TERM HISTORY =================
+
+// Original record: fixed array entries with text formatted on every push
+typedef struct {
+    char name[50];
+    char icon[10];
+    int calories;
+    char timestamp[30];
+    char consequence[100];
+} LegacyCheatMeal;
+
+double elapsedMs(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+// Push n sins (one per hour), reading the total after every push, then
+// pop them all; old push + O(n) total vs segmented stack + running total
+void benchmarkHistory(long n) {
+    char *names[] = { "Pizza", "Burger with Fries", "Maggi", "Cola", "Samosa", "Ice Cream" };
+    char *icons[] = { "🍕", "🍔", "🍜", "🥤", "🥟", "🍦" };
+    int calories[] = { 700, 550, 400, 150, 250, 280 };
+    int64_t start = 1700000000;
+    long checksumLegacy = 0, checksumStack = 0;
+    
+    // Legacy: one big array (the old 50-entry array could not hold this at all)
+    LegacyCheatMeal *legacy = (LegacyCheatMeal*)malloc(n * sizeof(LegacyCheatMeal));
+    clock_t begin = clock();
+    for (long i = 0; i < n; i++) {
+        LegacyCheatMeal *cheat = &legacy[i];
+        strcpy(cheat->name, names[i % 6]);
+        strcpy(cheat->icon, icons[i % 6]);
+        cheat->calories = calories[i % 6];
+        time_t when = (time_t)(start + i * 3600);
+        strftime(cheat->timestamp, sizeof(cheat->timestamp), "%Y-%m-%d %H:%M:%S", localtime(&when));
+        sprintf(cheat->consequence, "🔥 %d kcal = Goal delayed by ~%d day(s)",
+                cheat->calories, cheat->calories / 500);
+        if (i % 100 == 0) {
+            long total = 0;
+            for (long j = 0; j <= i; j++) total += legacy[j].calories;
+            checksumLegacy += total;
+        }
+    }
+    double legacyMs = elapsedMs(begin);
+    free(legacy);
+    
+    CheatStack stack;
+    initStack(&stack);
+    begin = clock();
+    for (long i = 0; i < n; i++) {
+        pushCheat(&stack, names[i % 6], icons[i % 6], calories[i % 6], start + i * 3600);
+        if (i % 100 == 0) checksumStack += getTotalSinCalories(&stack);
+    }
+    double stackMs = elapsedMs(begin);
+    
+    begin = clock();
+    CheatMeal removed;
+    while (popCheat(&stack, &removed) == 0) {}
+    double popMs = elapsedMs(begin);
+    
+    printf("=== BENCHMARK: %ld sins, total read every 100 pushes ===\n", n);
+    printf("format on push + O(n) total : %8.1f ms (%zu B per entry)\n",
+           legacyMs, sizeof(LegacyCheatMeal));
+    printf("segmented + running total   : %8.1f ms (%zu B per entry), pop all %.1f ms\n",
+           stackMs, sizeof(CheatMeal), popMs);
+    printf("Same totals: %s, empty total after popping: %ld kcal\n\n",
+           checksumLegacy == checksumStack ? "Yes" : "No", getTotalSinCalories(&stack));
+    freeStack(&stack);
+}
+
 // Main function demonstrating Stack operations
 int main() {
     CheatStack sinStack;
+    if (initStringPool(&junkNames) != 0) return 1;
     initStack(&sinStack);
     
     printf("\n=== NutriPlan Cheat Meal Tracker (Stack - LIFO) ===\n\n");
@@ -187,7 +323,8 @@ int main() {
     // Peek at top sin
     printf("--- PEEKING AT TOP SIN (WITHOUT REMOVING) ---\n");
     CheatMeal topSin = peek(&sinStack);
-    printf("Top sin: %s %s (%d kcal)\n\n", topSin.icon, topSin.name, topSin.calories);
+    printf("Top sin: %s %s (%d kcal)\n\n", poolString(&junkNames, topSin.icon),
+           poolString(&junkNames, topSin.name), topSin.calories);
     
     // User regrets and undos last 2 sins (POP operations)
     printf("--- USER REGRETS AND UNDOS LAST 2 SINS ---\n\n");
@@ -206,10 +343,9 @@ int main() {
     
     // Test stack properties
     printf("--- STACK STATISTICS ---\n");
-    printf("Current stack size: %d\n", getSize(&sinStack));
-    printf("Total damage: %d kcal\n", getTotalSinCalories(&sinStack));
-    printf("Is empty? %s\n", isEmpty(&sinStack) ? "Yes" : "No");
-    printf("Is full? %s\n\n", isFull(&sinStack) ? "Yes" : "No");
+    printf("Current stack size: %ld\n", getSize(&sinStack));
+    printf("Total damage: %ld kcal\n", getTotalSinCalories(&sinStack));
+    printf("Is empty? %s\n\n", isEmpty(&sinStack) ? "Yes" : "No");
     
     // Undo all remaining sins
     printf("--- UNDOING ALL REMAINING SINS ---\n\n");
@@ -227,5 +363,8 @@ int main() {
     printf("Key takeaway: LIFO - Last In, First Out\n");
     printf("Most recent cheat is always at TOP and removed first\n\n");
     
+    freeStack(&sinStack);
+    benchmarkHistory(50000);
+    freeStringPool(&junkNames);
     return 0;
 }
\ No newline at end of file
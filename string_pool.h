@@ -0,0 +1,195 @@
+// Interned String Pool and Shared Tag Enums
+// NutriPlan - Data Structures Project
+// Every distinct string (food name, hindi name, icon, recipe step) is
+// stored once in one growable buffer and records keep a 32-bit id instead
+// of a fixed char[] buffer: records shrink, equal strings have equal ids,
+// and nothing is strcpy'd into a buffer that might be too small.
+// The closed vocabularies (diet type, goal, meal time) are small enums.
+
+#ifndef STRING_POOL_H
+#define STRING_POOL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+// Byte offset of the string inside the pool
+typedef uint32_t StringId;
+
+#define EMPTY_STRING 0   // id of "" - zeroed records are valid
+
+typedef struct {
+    char *data;          // NUL-terminated strings back to back
+    uint32_t size;
+    uint32_t capacity;
+    uint32_t *slots;     // open-addressing table of id + 1 (0 = empty slot)
+    uint32_t slotCount;  // power of two
+    uint32_t count;      // distinct strings, including ""
+} StringPool;
+
+// FNV-1a
+static inline uint32_t poolHash(const char *s) {
+    uint32_t h = 2166136261u;
+    while (*s) {
+        h ^= (uint8_t)*s++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// Returns 0 on success, -1 if out of memory
+static inline int initStringPool(StringPool *pool) {
+    pool->capacity = 1024;
+    pool->slotCount = 64;
+    pool->data = (char*)malloc(pool->capacity);
+    pool->slots = (uint32_t*)calloc(pool->slotCount, sizeof(uint32_t));
+    if (pool->data == NULL || pool->slots == NULL) {
+        printf("❌ Memory allocation failed!\n");
+        return -1;
+    }
+    pool->data[0] = '\0';  // EMPTY_STRING
+    pool->size = 1;
+    pool->count = 1;
+    pool->slots[poolHash("") & (pool->slotCount - 1)] = EMPTY_STRING + 1;
+    return 0;
+}
+
+static inline void freeStringPool(StringPool *pool) {
+    free(pool->data);
+    free(pool->slots);
+    memset(pool, 0, sizeof(StringPool));
+}
+
+// Double the slot table and reinsert every id
+// Time Complexity: O(count)
+static inline int poolGrowSlots(StringPool *pool) {
+    uint32_t newCount = pool->slotCount * 2;
+    uint32_t *slots = (uint32_t*)calloc(newCount, sizeof(uint32_t));
+    if (slots == NULL) return -1;
+    for (uint32_t i = 0; i < pool->slotCount; i++) {
+        if (pool->slots[i] == 0) continue;
+        uint32_t h = poolHash(pool->data + pool->slots[i] - 1) & (newCount - 1);
+        while (slots[h] != 0) h = (h + 1) & (newCount - 1);
+        slots[h] = pool->slots[i];
+    }
+    free(pool->slots);
+    pool->slots = slots;
+    pool->slotCount = newCount;
+    return 0;
+}
+
+// Id of s, adding it to the pool on first sight
+// Returns EMPTY_STRING (after printing an error) if the pool cannot grow
+// Time Complexity: O(length) expected
+static inline StringId internString(StringPool *pool, const char *s) {
+    uint32_t mask = pool->slotCount - 1;
+    uint32_t h = poolHash(s) & mask;
+    while (pool->slots[h] != 0) {
+        if (strcmp(pool->data + pool->slots[h] - 1, s) == 0) return pool->slots[h] - 1;
+        h = (h + 1) & mask;
+    }
+
+    size_t length = strlen(s) + 1;
+    if (pool->size + length > pool->capacity) {
+        size_t newCapacity = pool->capacity;
+        while (pool->size + length > newCapacity) newCapacity *= 2;
+        char *grown = newCapacity <= UINT32_MAX ? (char*)realloc(pool->data, newCapacity) : NULL;
+        if (grown == NULL) {
+            printf("❌ String pool is full!\n");
+            return EMPTY_STRING;
+        }
+        pool->data = grown;
+        pool->capacity = (uint32_t)newCapacity;
+    }
+
+    StringId id = pool->size;
+    memcpy(pool->data + id, s, length);
+    pool->size += (uint32_t)length;
+    pool->slots[h] = id + 1;
+    pool->count++;
+    if (pool->count * 2 > pool->slotCount && poolGrowSlots(pool) != 0) {
+        printf("❌ String pool index is full!\n");
+    }
+    return id;
+}
+
+// Text of an id (valid until the next internString call that grows the pool)
+static inline const char* poolString(const StringPool *pool, StringId id) {
+    return pool->data + id;
+}
+
+// ================= SHARED TAGS =================
+
+typedef enum {
+    DIET_VEG,
+    DIET_NON_VEG,
+    DIET_EGG,
+    NUM_DIET_TYPES
+} DietType;
+
+#define DIET_ANY (-1)       // "all" filter
+#define DIET_UNKNOWN (-2)   // not a diet name (typo, missing field)
+
+// Diet type bits (a food has exactly one): bit d is DietType d
+#define DIET_MASK_VEG      (1u << DIET_VEG)
+#define DIET_MASK_NON_VEG  (1u << DIET_NON_VEG)
+#define DIET_MASK_EGG      (1u << DIET_EGG)
+
+typedef enum {
+    GOAL_WEIGHT_LOSS,
+    GOAL_MUSCLE_GAIN,
+    GOAL_MAINTAIN,
+    GOAL_PCOD,
+    GOAL_DEFAULT,       // any other goal (e.g. eat-better) uses the default rule
+    NUM_GOALS
+} Goal;
+
+typedef enum {
+    MEAL_MORNING,
+    MEAL_AFTERNOON,
+    MEAL_EVENING,
+    NUM_MEAL_TIMES
+} MealTime;
+
+static inline const char* dietTypeName(int diet) {
+    static const char *names[NUM_DIET_TYPES] = { "veg", "non-veg", "egg" };
+    if (diet >= 0 && diet < NUM_DIET_TYPES) return names[diet];
+    return diet == DIET_ANY ? "all" : "unknown";
+}
+
+static inline const char* goalName(int goal) {
+    static const char *names[NUM_GOALS] = { "weight-loss", "muscle-gain", "maintain", "pcod", "default" };
+    return goal >= 0 && goal < NUM_GOALS ? names[goal] : "default";
+}
+
+static inline const char* mealTimeName(int time) {
+    static const char *names[NUM_MEAL_TIMES] = { "morning", "afternoon", "evening" };
+    return time >= 0 && time < NUM_MEAL_TIMES ? names[time] : "";
+}
+
+// Diet string -> DietType, DIET_ANY for "all", DIET_UNKNOWN for anything else
+static inline int parseDietType(const char *dietType) {
+    for (int d = 0; d < NUM_DIET_TYPES; d++) {
+        if (strcmp(dietType, dietTypeName(d)) == 0) return d;
+    }
+    return strcmp(dietType, "all") == 0 ? DIET_ANY : DIET_UNKNOWN;
+}
+
+// Goal string -> Goal (unknown goals use the default rule)
+static inline Goal parseGoal(const char *goal) {
+    for (int g = 0; g < GOAL_DEFAULT; g++) {
+        if (strcmp(goal, goalName(g)) == 0) return (Goal)g;
+    }
+    return GOAL_DEFAULT;
+}
+
+// Meal time string -> MealTime, -1 if unknown
+static inline int parseMealTime(const char *time) {
+    for (int t = 0; t < NUM_MEAL_TIMES; t++) {
+        if (strcmp(time, mealTimeName(t)) == 0) return t;
+    }
+    return -1;
+}
+
+#endif
@@ -5,52 +5,77 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <time.h>
+#include "string_pool.h"
+#include "arena.h"
+
+// Names of every food in this program, interned once
+StringPool foodNames;
 
 // Food node structure
 typedef struct FoodNode {
-    char name[50];
-    char hindiName[50];
+    StringId name;
+    StringId hindiName;
     int calories;
     float protein;
     float carbs;
     float fats;
     int cost;  // in rupees
-    char dietType[20];  // veg/non-veg/egg
+    uint8_t dietType;  // DietType
     struct FoodNode *left;
     struct FoodNode *right;
 } FoodNode;
 
+// Take one node from the tree's pool (malloc when pool is NULL)
+// Returns NULL (message printed) when out of memory
+static inline void* allocNode(SlabPool *pool, size_t size) {
+    void *node = pool != NULL ? slabAlloc(pool) : malloc(size);
+    if (node == NULL) printf("❌ Memory allocation failed!\n");
+    return node;
+}
+
 // Create new food node
-FoodNode* createNode(char *name, char *hindiName, int calories, float protein, 
+// Nodes come from pool and are dropped together with slabReset/freeSlabPool;
+// pass NULL to malloc each node and release with freeTree instead
+// Returns NULL (message printed) if the diet type is unknown or out of memory
+FoodNode* createNode(SlabPool *pool, char *name, char *hindiName, int calories, float protein, 
                      float carbs, float fats, int cost, char *dietType) {
-    FoodNode *newNode = (FoodNode*)malloc(sizeof(FoodNode));
-    strcpy(newNode->name, name);
-    strcpy(newNode->hindiName, hindiName);
+    int diet = parseDietType(dietType);
+    if (diet == DIET_UNKNOWN || diet == DIET_ANY) {
+        printf("❌ Unknown diet type '%s'!\n", dietType);
+        return NULL;
+    }
+    FoodNode *newNode = (FoodNode*)allocNode(pool, sizeof(FoodNode));
+    if (newNode == NULL) return NULL;
+    newNode->name = internString(&foodNames, name);
+    newNode->hindiName = internString(&foodNames, hindiName);
     newNode->calories = calories;
     newNode->protein = protein;
     newNode->carbs = carbs;
     newNode->fats = fats;
     newNode->cost = cost;
-    strcpy(newNode->dietType, dietType);
+    newNode->dietType = (uint8_t)diet;
     newNode->left = NULL;
     newNode->right = NULL;
     return newNode;
 }
 
 // Insert food into BST (ordered by calories)
+// A food createNode rejects is not inserted and the tree is left unchanged
 // Time Complexity: O(log n) average, O(n) worst case
 // Space Complexity: O(1)
-FoodNode* insertFood(FoodNode *root, char *name, char *hindiName, int calories, 
+FoodNode* insertFood(SlabPool *pool, FoodNode *root, char *name, char *hindiName, int calories, 
                      float protein, float carbs, float fats, int cost, char *dietType) {
     if (root == NULL) {
-        return createNode(name, hindiName, calories, protein, carbs, fats, cost, dietType);
+        return createNode(pool, name, hindiName, calories, protein, carbs, fats, cost, dietType);
     }
     
     if (calories < root->calories) {
-        root->left = insertFood(root->left, name, hindiName, calories, protein, 
+        root->left = insertFood(pool, root->left, name, hindiName, calories, protein, 
                                carbs, fats, cost, dietType);
     } else {
-        root->right = insertFood(root->right, name, hindiName, calories, protein, 
+        root->right = insertFood(pool, root->right, name, hindiName, calories, protein, 
                                 carbs, fats, cost, dietType);
     }
     
@@ -60,27 +85,28 @@ FoodNode* insertFood(FoodNode *root, char *name, char *hindiName, int calories,
 // Search foods within calorie range (for goal-based filtering)
 // Time Complexity: O(n) worst case, O(log n) average
 // Space Complexity: O(h) for recursion stack, where h is height
-void searchInRange(FoodNode *root, int minCal, int maxCal, char *dietType) {
+// diet is a DietType or DIET_ANY; DIET_UNKNOWN matches nothing
+void searchInRange(FoodNode *root, int minCal, int maxCal, int diet) {
     if (root == NULL) return;
     
     // Check left subtree if min is less than current
     if (minCal < root->calories) {
-        searchInRange(root->left, minCal, maxCal, dietType);
+        searchInRange(root->left, minCal, maxCal, diet);
     }
     
     // Print if in range and matches diet type
     if (root->calories >= minCal && root->calories <= maxCal) {
-        if (strcmp(dietType, "all") == 0 || strcmp(root->dietType, dietType) == 0) {
+        if (diet == DIET_ANY || root->dietType == diet) {
             printf("%-25s %-20s %4d kcal | P:%.1fg C:%.1fg F:%.1fg | Rs.%d | %s\n", 
-                   root->name, root->hindiName, root->calories, 
+                   poolString(&foodNames, root->name), poolString(&foodNames, root->hindiName), root->calories, 
                    root->protein, root->carbs, root->fats, 
-                   root->cost, root->dietType);
+                   root->cost, dietTypeName(root->dietType));
         }
     }
     
     // Check right subtree if max is greater than current
     if (maxCal > root->calories) {
-        searchInRange(root->right, minCal, maxCal, dietType);
+        searchInRange(root->right, minCal, maxCal, diet);
     }
 }
 
@@ -90,7 +116,7 @@ void searchInRange(FoodNode *root, int minCal, int maxCal, char *dietType) {
 void inorderTraversal(FoodNode *root) {
     if (root != NULL) {
         inorderTraversal(root->left);
-        printf("%s (%d kcal) ", root->name, root->calories);
+        printf("%s (%d kcal) ", poolString(&foodNames, root->name), root->calories);
         inorderTraversal(root->right);
     }
 }
@@ -117,49 +143,484 @@ int countNodes(FoodNode *root) {
     return 1 + countNodes(root->left) + countNodes(root->right);
 }
 
+// Height of the plain BST (used to show degeneration on sorted input)
+// Time Complexity: O(n)
+int treeHeight(FoodNode *root) {
+    if (root == NULL) return 0;
+    int lh = treeHeight(root->left);
+    int rh = treeHeight(root->right);
+    return 1 + (lh > rh ? lh : rh);
+}
+
+// Count foods within calorie range without printing
+// Time Complexity: O(n) worst case, O(log n + k) average
+// Space Complexity: O(h) for recursion stack
+int countInRange(FoodNode *root, int minCal, int maxCal) {
+    if (root == NULL) return 0;
+    int count = 0;
+    if (minCal < root->calories) count += countInRange(root->left, minCal, maxCal);
+    if (root->calories >= minCal && root->calories <= maxCal) count++;
+    if (maxCal >= root->calories) count += countInRange(root->right, minCal, maxCal);  // equal keys go right
+    return count;
+}
+
+// Free every node of a malloc'd (pool == NULL) plain BST
+void freeTree(FoodNode *root) {
+    if (root == NULL) return;
+    freeTree(root->left);
+    freeTree(root->right);
+    free(root);
+}
+
+// ================= SELF-BALANCING (AVL) FOOD INDEX =================
+// Same payload as FoodNode plus height and subtree size. Rotations keep
+// the height at O(log n) even when the catalogue arrives sorted by
+// calories, and the size field makes counting O(1) / O(log n).
+
+typedef struct AVLFoodNode {
+    StringId name;
+    StringId hindiName;
+    int calories;
+    float protein;
+    float carbs;
+    float fats;
+    int cost;  // in rupees
+    uint8_t dietType;  // DietType
+    int height;  // height of this subtree (leaf = 1)
+    int size;    // number of foods in this subtree
+    struct AVLFoodNode *left;
+    struct AVLFoodNode *right;
+} AVLFoodNode;
+
+int avlHeight(AVLFoodNode *node) {
+    return node == NULL ? 0 : node->height;
+}
+
+int avlSize(AVLFoodNode *node) {
+    return node == NULL ? 0 : node->size;
+}
+
+// Recompute height and size from children
+// Time Complexity: O(1)
+void avlUpdate(AVLFoodNode *node) {
+    int lh = avlHeight(node->left);
+    int rh = avlHeight(node->right);
+    node->height = 1 + (lh > rh ? lh : rh);
+    node->size = 1 + avlSize(node->left) + avlSize(node->right);
+}
+
+// Right rotation around node (left child becomes subtree root)
+// Time Complexity: O(1)
+AVLFoodNode* rotateRight(AVLFoodNode *node) {
+    AVLFoodNode *pivot = node->left;
+    node->left = pivot->right;
+    pivot->right = node;
+    avlUpdate(node);
+    avlUpdate(pivot);
+    return pivot;
+}
+
+// Left rotation around node (right child becomes subtree root)
+// Time Complexity: O(1)
+AVLFoodNode* rotateLeft(AVLFoodNode *node) {
+    AVLFoodNode *pivot = node->right;
+    node->right = pivot->left;
+    pivot->left = node;
+    avlUpdate(node);
+    avlUpdate(pivot);
+    return pivot;
+}
+
+// Restore the AVL invariant at node after an insertion below it
+// Time Complexity: O(1)
+AVLFoodNode* rebalance(AVLFoodNode *node) {
+    avlUpdate(node);
+    int balance = avlHeight(node->left) - avlHeight(node->right);
+
+    if (balance > 1) {
+        if (avlHeight(node->left->left) < avlHeight(node->left->right)) {
+            node->left = rotateLeft(node->left);  // Left-Right case
+        }
+        return rotateRight(node);
+    }
+    if (balance < -1) {
+        if (avlHeight(node->right->right) < avlHeight(node->right->left)) {
+            node->right = rotateRight(node->right);  // Right-Left case
+        }
+        return rotateLeft(node);
+    }
+    return node;
+}
+
+// Create new balanced food node (pool and errors as in createNode)
+AVLFoodNode* createAVLNode(SlabPool *pool, char *name, char *hindiName, int calories, float protein,
+                           float carbs, float fats, int cost, char *dietType) {
+    int diet = parseDietType(dietType);
+    if (diet == DIET_UNKNOWN || diet == DIET_ANY) {
+        printf("❌ Unknown diet type '%s'!\n", dietType);
+        return NULL;
+    }
+    AVLFoodNode *newNode = (AVLFoodNode*)allocNode(pool, sizeof(AVLFoodNode));
+    if (newNode == NULL) return NULL;
+    newNode->name = internString(&foodNames, name);
+    newNode->hindiName = internString(&foodNames, hindiName);
+    newNode->calories = calories;
+    newNode->protein = protein;
+    newNode->carbs = carbs;
+    newNode->fats = fats;
+    newNode->cost = cost;
+    newNode->dietType = (uint8_t)diet;
+    newNode->height = 1;
+    newNode->size = 1;
+    newNode->left = NULL;
+    newNode->right = NULL;
+    return newNode;
+}
+
+// Insert food into AVL tree (ordered by calories, equal keys go right)
+// A rejected food leaves the tree unchanged, as in insertFood
+// Time Complexity: O(log n) worst case
+// Space Complexity: O(log n) for recursion
+AVLFoodNode* insertFoodAVL(SlabPool *pool, AVLFoodNode *root, char *name, char *hindiName, int calories,
+                           float protein, float carbs, float fats, int cost, char *dietType) {
+    if (root == NULL) {
+        return createAVLNode(pool, name, hindiName, calories, protein, carbs, fats, cost, dietType);
+    }
+
+    if (calories < root->calories) {
+        root->left = insertFoodAVL(pool, root->left, name, hindiName, calories, protein,
+                                   carbs, fats, cost, dietType);
+    } else {
+        root->right = insertFoodAVL(pool, root->right, name, hindiName, calories, protein,
+                                    carbs, fats, cost, dietType);
+    }
+
+    return rebalance(root);
+}
+
+// Search foods within calorie range (same output as searchInRange)
+// Time Complexity: O(log n + k) where k is the number of matches
+// Space Complexity: O(log n) for recursion
+// Rotations can move equal calories to either side, so both bounds are inclusive
+void searchInRangeAVL(AVLFoodNode *root, int minCal, int maxCal, int diet) {
+    if (root == NULL) return;
+
+    if (minCal <= root->calories) {
+        searchInRangeAVL(root->left, minCal, maxCal, diet);
+    }
+
+    if (root->calories >= minCal && root->calories <= maxCal) {
+        if (diet == DIET_ANY || root->dietType == diet) {
+            printf("%-25s %-20s %4d kcal | P:%.1fg C:%.1fg F:%.1fg | Rs.%d | %s\n",
+                   poolString(&foodNames, root->name), poolString(&foodNames, root->hindiName), root->calories,
+                   root->protein, root->carbs, root->fats,
+                   root->cost, dietTypeName(root->dietType));
+        }
+    }
+
+    if (maxCal >= root->calories) {
+        searchInRangeAVL(root->right, minCal, maxCal, diet);
+    }
+}
+
+// Number of foods with calories strictly below the given value
+// Time Complexity: O(log n)
+// Space Complexity: O(1)
+int countBelowAVL(AVLFoodNode *root, int calories) {
+    int count = 0;
+    while (root != NULL) {
+        if (root->calories < calories) {
+            count += avlSize(root->left) + 1;
+            root = root->right;
+        } else {
+            root = root->left;
+        }
+    }
+    return count;
+}
+
+// Number of foods with calories at or below the given value
+// (no maxCal + 1, which overflows for INT_MAX)
+// Time Complexity: O(log n)
+// Space Complexity: O(1)
+int countAtMostAVL(AVLFoodNode *root, int calories) {
+    int count = 0;
+    while (root != NULL) {
+        if (root->calories <= calories) {
+            count += avlSize(root->left) + 1;
+            root = root->right;
+        } else {
+            root = root->left;
+        }
+    }
+    return count;
+}
+
+// Count foods within calorie range using subtree sizes
+// Time Complexity: O(log n)
+// Space Complexity: O(1)
+int countInRangeAVL(AVLFoodNode *root, int minCal, int maxCal) {
+    if (minCal > maxCal) return 0;
+    return countAtMostAVL(root, maxCal) - countBelowAVL(root, minCal);
+}
+
+// Inorder traversal (prints foods in ascending calorie order)
+// Time Complexity: O(n)
+void inorderTraversalAVL(AVLFoodNode *root) {
+    if (root != NULL) {
+        inorderTraversalAVL(root->left);
+        printf("%s (%d kcal) ", poolString(&foodNames, root->name), root->calories);
+        inorderTraversalAVL(root->right);
+    }
+}
+
+// Find minimum calorie food (leftmost node)
+// Time Complexity: O(log n)
+AVLFoodNode* findMinAVL(AVLFoodNode *root) {
+    while (root->left != NULL) {
+        root = root->left;
+    }
+    return root;
+}
+
+// Find maximum calorie food (rightmost node)
+// Time Complexity: O(log n)
+AVLFoodNode* findMaxAVL(AVLFoodNode *root) {
+    while (root->right != NULL) {
+        root = root->right;
+    }
+    return root;
+}
+
+// Count total foods in database
+// Time Complexity: O(1) - read from the root's subtree size
+int countNodesAVL(AVLFoodNode *root) {
+    return avlSize(root);
+}
+
+// Free every node of a malloc'd (pool == NULL) AVL tree
+void freeTreeAVL(AVLFoodNode *root) {
+    if (root == NULL) return;
+    freeTreeAVL(root->left);
+    freeTreeAVL(root->right);
+    free(root);
+}
+
+// ================= BENCHMARK: PLAIN BST vs AVL =================
+
+double elapsedMs(clock_t start) {
+    return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+// Build both trees from the same calorie sequence and time inserts,
+// range counts and countNodes
+void benchmarkOrder(const char *label, int *calories, int n, int queries) {
+    char name[50];
+    FoodNode *bst = NULL;
+    AVLFoodNode *avl = NULL;
+    SlabPool bstNodes, avlNodes;
+    initSlabPool(&bstNodes, sizeof(FoodNode), 1024);
+    initSlabPool(&avlNodes, sizeof(AVLFoodNode), 1024);
+    long checksumBst = 0, checksumAvl = 0;
+
+    clock_t start = clock();
+    for (int i = 0; i < n; i++) {
+        sprintf(name, "Food %d", i);
+        bst = insertFood(&bstNodes, bst, name, "", calories[i], 10.0, 20.0, 5.0, 30, "veg");
+    }
+    double bstInsert = elapsedMs(start);
+
+    start = clock();
+    for (int i = 0; i < n; i++) {
+        sprintf(name, "Food %d", i);
+        avl = insertFoodAVL(&avlNodes, avl, name, "", calories[i], 10.0, 20.0, 5.0, 30, "veg");
+    }
+    double avlInsert = elapsedMs(start);
+
+    start = clock();
+    for (int q = 0; q < queries; q++) {
+        int lo = (q * 7919) % n;
+        checksumBst += countInRange(bst, lo, lo + 200);
+    }
+    double bstQuery = elapsedMs(start);
+
+    start = clock();
+    for (int q = 0; q < queries; q++) {
+        int lo = (q * 7919) % n;
+        checksumAvl += countInRangeAVL(avl, lo, lo + 200);
+    }
+    double avlQuery = elapsedMs(start);
+
+    start = clock();
+    int bstCount = countNodes(bst);
+    double bstCountMs = elapsedMs(start);
+
+    start = clock();
+    int avlCount = countNodesAVL(avl);
+    double avlCountMs = elapsedMs(start);
+
+    printf("%-8s | BST: height %6d, insert %8.1f ms, %d range counts %8.1f ms, countNodes %6.2f ms\n",
+           label, treeHeight(bst), bstInsert, queries, bstQuery, bstCountMs);
+    printf("%-8s | AVL: height %6d, insert %8.1f ms, %d range counts %8.1f ms, countNodes %6.2f ms\n",
+           label, avlHeight(avl), avlInsert, queries, avlQuery, avlCountMs);
+    if (checksumBst != checksumAvl || bstCount != avlCount) {
+        printf("❌ Mismatch between BST and AVL results!\n");
+    }
+
+    freeSlabPool(&bstNodes);
+    freeSlabPool(&avlNodes);
+}
+
+// Compare both trees on a catalogue already sorted by calories (like our
+// export) and on a shuffled one
+void benchmarkTrees(int n, int queries) {
+    int *sorted = (int*)malloc(n * sizeof(int));
+    int *shuffled = (int*)malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        sorted[i] = i;
+        shuffled[i] = i;
+    }
+    srand(42);
+    for (int i = n - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int tmp = shuffled[i];
+        shuffled[i] = shuffled[j];
+        shuffled[j] = tmp;
+    }
+
+    printf("=== BENCHMARK: %d foods ===\n", n);
+    benchmarkOrder("sorted", sorted, n, queries);
+    benchmarkOrder("random", shuffled, n, queries);
+    printf("\n");
+
+    free(sorted);
+    free(shuffled);
+}
+
+// ================= BENCHMARK: ALLOCATOR CHURN =================
+
+// Load the whole catalogue into an AVL tree and drop it, rounds times:
+// one malloc/free per node vs a slab pool reset between loads
+void benchmarkChurn(int n, int rounds) {
+    char name[50];
+    int *calories = (int*)malloc(n * sizeof(int));
+    srand(7);
+    for (int i = 0; i < n; i++) {
+        calories[i] = 100 + rand() % 500;
+    }
+    long checksumMalloc = 0, checksumPool = 0;
+
+    clock_t start = clock();
+    for (int round = 0; round < rounds; round++) {
+        AVLFoodNode *tree = NULL;
+        for (int i = 0; i < n; i++) {
+            sprintf(name, "Food %d", i);
+            tree = insertFoodAVL(NULL, tree, name, "", calories[i], 10.0, 20.0, 5.0, 30, "veg");
+        }
+        checksumMalloc += countInRangeAVL(tree, 200, 400);
+        freeTreeAVL(tree);
+    }
+    double mallocMs = elapsedMs(start);
+
+    SlabPool nodes;
+    initSlabPool(&nodes, sizeof(AVLFoodNode), 1024);
+    start = clock();
+    for (int round = 0; round < rounds; round++) {
+        AVLFoodNode *tree = NULL;
+        for (int i = 0; i < n; i++) {
+            sprintf(name, "Food %d", i);
+            tree = insertFoodAVL(&nodes, tree, name, "", calories[i], 10.0, 20.0, 5.0, 30, "veg");
+        }
+        checksumPool += countInRangeAVL(tree, 200, 400);
+        slabReset(&nodes);
+    }
+    double poolMs = elapsedMs(start);
+
+    printf("=== BENCHMARK: load + drop %d foods x %d rounds ===\n", n, rounds);
+    printf("malloc/free per node : %8.1f ms (%d mallocs, %d frees)\n",
+           mallocMs, n * rounds, n * rounds);
+    printf("slab pool + reset    : %8.1f ms (%zu mallocs, %zu resets)\n",
+           poolMs, nodes.arena.stats.blocks, nodes.arena.stats.resets);
+    printAllocStats("final", &nodes.arena.stats, "AVL node pool");
+    printf("Same trees: %s\n\n", checksumMalloc == checksumPool ? "Yes" : "No");
+
+    freeSlabPool(&nodes);
+    free(calories);
+}
+
 // Main function demonstrating BST operations
 int main() {
-    FoodNode *root = NULL;
+    AVLFoodNode *root = NULL;
+    if (initStringPool(&foodNames) != 0) return 1;
+    SlabPool catalogueNodes;
+    initSlabPool(&catalogueNodes, sizeof(AVLFoodNode), 64);
     
-    printf("=== NutriPlan Food Database (Binary Search Tree) ===\n\n");
+    printf("=== NutriPlan Food Database (Balanced Binary Search Tree) ===\n\n");
     
     // Insert Indian foods - organized by calories
-    root = insertFood(root, "Moong Dal Cheela", "मूंग दाल चीला", 180, 12.0, 25.0, 4.0, 20, "veg");
-    root = insertFood(root, "Oats Upma", "ओट्स उपमा", 210, 8.0, 32.0, 6.0, 25, "veg");
-    root = insertFood(root, "Egg Bhurji", "अंडा भुर्जी", 220, 18.0, 8.0, 14.0, 30, "egg");
-    root = insertFood(root, "Boiled Eggs", "उबले अंडे", 240, 16.0, 22.0, 11.0, 25, "egg");
-    root = insertFood(root, "Poha", "पोहा", 250, 6.0, 40.0, 7.0, 15, "veg");
-    root = insertFood(root, "Paneer Bhurji", "पनीर भुर्जी", 265, 18.5, 8.0, 14.0, 65, "veg");
-    root = insertFood(root, "Idli Sambar", "इडली सांभर", 280, 10.0, 48.0, 6.0, 40, "veg");
-    root = insertFood(root, "Dal Tadka", "दाल तड़का", 320, 14.0, 48.0, 8.0, 30, "veg");
-    root = insertFood(root, "Fish Curry", "मछली करी", 320, 28.0, 22.0, 14.0, 90, "non-veg");
-    root = insertFood(root, "Paneer Paratha", "पनीर पराठा", 320, 15.0, 40.0, 12.0, 50, "veg");
-    root = insertFood(root, "Rajma Chawal", "राजमा चावल", 380, 16.0, 58.0, 9.0, 35, "veg");
-    root = insertFood(root, "Chicken Curry", "चिकन करी", 380, 32.0, 35.0, 12.0, 80, "non-veg");
-    root = insertFood(root, "Egg Curry", "अंडा करी", 350, 20.0, 48.0, 10.0, 45, "egg");
-    root = insertFood(root, "Chole", "छोले", 420, 18.0, 65.0, 10.0, 45, "veg");
-    
-    printf("Total foods in database: %d\n\n", countNodes(root));
+    root = insertFoodAVL(&catalogueNodes, root, "Moong Dal Cheela", "मूंग दाल चीला", 180, 12.0, 25.0, 4.0, 20, "veg");
+    root = insertFoodAVL(&catalogueNodes, root, "Oats Upma", "ओट्स उपमा", 210, 8.0, 32.0, 6.0, 25, "veg");
+    root = insertFoodAVL(&catalogueNodes, root, "Egg Bhurji", "अंडा भुर्जी", 220, 18.0, 8.0, 14.0, 30, "egg");
+    root = insertFoodAVL(&catalogueNodes, root, "Boiled Eggs", "उबले अंडे", 240, 16.0, 22.0, 11.0, 25, "egg");
+    root = insertFoodAVL(&catalogueNodes, root, "Poha", "पोहा", 250, 6.0, 40.0, 7.0, 15, "veg");
+    root = insertFoodAVL(&catalogueNodes, root, "Paneer Bhurji", "पनीर भुर्जी", 265, 18.5, 8.0, 14.0, 65, "veg");
+    root = insertFoodAVL(&catalogueNodes, root, "Idli Sambar", "इडली सांभर", 280, 10.0, 48.0, 6.0, 40, "veg");
+    root = insertFoodAVL(&catalogueNodes, root, "Dal Tadka", "दाल तड़का", 320, 14.0, 48.0, 8.0, 30, "veg");
+    root = insertFoodAVL(&catalogueNodes, root, "Fish Curry", "मछली करी", 320, 28.0, 22.0, 14.0, 90, "non-veg");
+    root = insertFoodAVL(&catalogueNodes, root, "Paneer Paratha", "पनीर पराठा", 320, 15.0, 40.0, 12.0, 50, "veg");
+    root = insertFoodAVL(&catalogueNodes, root, "Rajma Chawal", "राजमा चावल", 380, 16.0, 58.0, 9.0, 35, "veg");
+    root = insertFoodAVL(&catalogueNodes, root, "Chicken Curry", "चिकन करी", 380, 32.0, 35.0, 12.0, 80, "non-veg");
+    root = insertFoodAVL(&catalogueNodes, root, "Egg Curry", "अंडा करी", 350, 20.0, 48.0, 10.0, 45, "egg");
+    root = insertFoodAVL(&catalogueNodes, root, "Chole", "छोले", 420, 18.0, 65.0, 10.0, 45, "veg");
+    
+    printf("Total foods in database: %d (tree height %d)\n\n", countNodesAVL(root), avlHeight(root));
+
+    // Unknown diets are rejected instead of being stored as a bogus code
+    int before = countNodesAVL(root);
+    root = insertFoodAVL(&catalogueNodes, root, "Tofu Tikka", "टोफू टिक्का", 260, 20.0, 10.0, 12.0, 60, "vegan");
+    printf("%s Unknown diet rejected, tree unchanged (%d foods)\n\n",
+           countNodesAVL(root) == before ? "✅" : "❌", countNodesAVL(root));
     
     printf("=== All Foods (Sorted by Calories - Inorder Traversal) ===\n");
-    inorderTraversal(root);
+    inorderTraversalAVL(root);
     printf("\n\n");
     
     // Find extremes
-    FoodNode *minFood = findMin(root);
-    FoodNode *maxFood = findMax(root);
-    printf("Lowest Calorie: %s (%d kcal)\n", minFood->name, minFood->calories);
-    printf("Highest Calorie: %s (%d kcal)\n\n", maxFood->name, maxFood->calories);
+    AVLFoodNode *minFood = findMinAVL(root);
+    AVLFoodNode *maxFood = findMaxAVL(root);
+    printf("Lowest Calorie: %s (%d kcal)\n", poolString(&foodNames, minFood->name), minFood->calories);
+    printf("Highest Calorie: %s (%d kcal)\n\n", poolString(&foodNames, maxFood->name), maxFood->calories);
     
     // Search by goal
     printf("=== WEIGHT LOSS Foods (150-300 kcal, Veg) ===\n");
-    searchInRange(root, 150, 300, "veg");
+    searchInRangeAVL(root, 150, 300, DIET_VEG);
     
     printf("\n=== MUSCLE GAIN Foods (300-450 kcal, Non-Veg) ===\n");
-    searchInRange(root, 300, 450, "non-veg");
+    searchInRangeAVL(root, 300, 450, DIET_NON_VEG);
     
     printf("\n=== ALL Foods in Moderate Range (250-350 kcal) ===\n");
-    searchInRange(root, 250, 350, "all");
+    searchInRangeAVL(root, 250, 350, DIET_ANY);
+    printf("Foods in 250-350 kcal: %d\n\n", countInRangeAVL(root, 250, 350));
+    printf("%s Open-ended range (>= 250 kcal, up to INT_MAX) counts %d foods\n\n",
+           countInRangeAVL(root, 250, INT_MAX) == countInRangeAVL(root, 250, 100000) ? "✅" : "❌",
+           countInRangeAVL(root, 250, INT_MAX));
+
+    // A misspelt filter must not fall back to "all"
+    printf("=== Filter 'vgean' (typo) ===\n");
+    searchInRangeAVL(root, 0, 1000, parseDietType("vgean"));
+    printf("%s Typo filter matches nothing\n\n",
+           parseDietType("vgean") == DIET_UNKNOWN && parseDietType("all") == DIET_ANY ? "✅" : "❌");
+    
+    freeSlabPool(&catalogueNodes);  // whole tree in one release
     
+    // Plain BST degenerates into a list on sorted input; the AVL tree does not.
+    // Plain BST recursion is O(n) deep on sorted input, so keep n moderate here.
+    benchmarkTrees(20000, 2000);
+    benchmarkChurn(100000, 20);
+    
+    printf("\nFoodNode: %zu bytes (was 160 with char[50]/char[50]/char[20] strings), "
+           "%u distinct names interned in %u bytes\n",
+           sizeof(FoodNode), foodNames.count, foodNames.size);
+    freeStringPool(&foodNames);
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,454 @@
+// Multi-User Meal Log and Sin Stack Store (Sharded, Lock-Striped)
+// NutriPlan - Data Structures Project
+// Server-side home for what each browser keeps in localStorage. Users are
+// spread over NUM_SHARDS shards by a hash of their id; each shard has its
+// own mutex, user table, name pool and record allocator, so threads
+// serving different users almost never wait on the same lock. A shard is
+// padded to its own cache lines so neighbouring locks do not false-share.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+#include "string_pool.h"
+#include "arena.h"
+
+#define NUM_SHARDS 64         // power of two
+#define MAX_THREADS 64
+#define CACHE_LINE 64
+
+typedef struct {
+    StringId name;
+    int32_t calories;
+    float protein;
+    float carbs;
+    int64_t loggedAt;
+} MealEntry;
+
+typedef struct {
+    StringId name;
+    StringId icon;
+    int32_t calories;
+    int64_t eatenAt;
+} SinEntry;
+
+typedef struct {
+    uint32_t userId;
+    MealEntry *meals;
+    int numMeals;
+    int mealCapacity;
+    SinEntry *sins;          // stack, top at numSins - 1
+    int numSins;
+    int sinCapacity;
+    long mealCalories;       // running totals, so summaries are O(1)
+    long sinCalories;
+} UserRecord;
+
+// Per-user figures returned to a caller (copied out under the lock)
+typedef struct {
+    int meals;
+    long mealCalories;
+    int sins;
+    long sinCalories;
+    int32_t topSinCalories;
+} UserSummary;
+
+typedef struct {
+    pthread_mutex_t lock;
+    UserRecord **slots;      // open addressing on userId
+    uint32_t slotCount;      // power of two
+    uint32_t numUsers;
+    StringPool names;
+    SlabPool users;          // UserRecord storage
+    uint64_t operations;
+} __attribute__((aligned(CACHE_LINE))) Shard;
+
+typedef struct {
+    Shard *shards;
+    int numShards;           // power of two; 1 = one global lock
+} UserStore;
+
+// ================= SHARDS =================
+
+// Mix the id so consecutive ids land on different shards and slots
+static inline uint32_t hashUser(uint32_t userId) {
+    uint32_t h = userId * 0x9E3779B1u;
+    return h ^ (h >> 16);
+}
+
+// Slot within a shard: the shard index used the low hash bits, so the
+// table probes with the high ones
+static inline uint32_t slotOf(uint32_t userId, uint32_t mask) {
+    return (hashUser(userId) >> 6) & mask;
+}
+
+static inline Shard* shardOf(UserStore *store, uint32_t userId) {
+    return &store->shards[hashUser(userId) & (store->numShards - 1)];
+}
+
+// Returns 0 on success, -1 if out of memory
+int initUserStore(UserStore *store, int numShards) {
+    store->numShards = numShards;
+    store->shards = (Shard*)aligned_alloc(CACHE_LINE, numShards * sizeof(Shard));
+    if (store->shards == NULL) {
+        printf("❌ Memory allocation failed!\n");
+        return -1;
+    }
+    for (int s = 0; s < numShards; s++) {
+        Shard *shard = &store->shards[s];
+        memset(shard, 0, sizeof(Shard));
+        pthread_mutex_init(&shard->lock, NULL);
+        shard->slotCount = 64;
+        shard->slots = (UserRecord**)calloc(shard->slotCount, sizeof(UserRecord*));
+        initSlabPool(&shard->users, sizeof(UserRecord), 256);
+        if (shard->slots == NULL || initStringPool(&shard->names) != 0) {
+            printf("❌ Memory allocation failed!\n");
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void freeUserStore(UserStore *store) {
+    for (int s = 0; s < store->numShards; s++) {
+        Shard *shard = &store->shards[s];
+        for (uint32_t i = 0; i < shard->slotCount; i++) {
+            if (shard->slots[i] == NULL) continue;
+            free(shard->slots[i]->meals);
+            free(shard->slots[i]->sins);
+        }
+        free(shard->slots);
+        freeStringPool(&shard->names);
+        freeSlabPool(&shard->users);
+        pthread_mutex_destroy(&shard->lock);
+    }
+    free(store->shards);
+    store->shards = NULL;
+}
+
+// Double a shard's table (caller holds the lock)
+int growShard(Shard *shard) {
+    uint32_t newCount = shard->slotCount * 2;
+    UserRecord **slots = (UserRecord**)calloc(newCount, sizeof(UserRecord*));
+    if (slots == NULL) return -1;
+    for (uint32_t i = 0; i < shard->slotCount; i++) {
+        UserRecord *user = shard->slots[i];
+        if (user == NULL) continue;
+        uint32_t h = slotOf(user->userId, newCount - 1);
+        while (slots[h] != NULL) h = (h + 1) & (newCount - 1);
+        slots[h] = user;
+    }
+    free(shard->slots);
+    shard->slots = slots;
+    shard->slotCount = newCount;
+    return 0;
+}
+
+// User's record, created on first use if create is set (caller holds the lock)
+// Time Complexity: O(1) expected
+UserRecord* findUser(Shard *shard, uint32_t userId, int create) {
+    uint32_t mask = shard->slotCount - 1;
+    uint32_t h = slotOf(userId, mask);
+    while (shard->slots[h] != NULL) {
+        if (shard->slots[h]->userId == userId) return shard->slots[h];
+        h = (h + 1) & mask;
+    }
+    if (!create) return NULL;
+
+    UserRecord *user = (UserRecord*)slabAlloc(&shard->users);
+    if (user == NULL) return NULL;
+    memset(user, 0, sizeof(UserRecord));
+    user->userId = userId;
+    shard->slots[h] = user;
+    shard->numUsers++;
+    if (shard->numUsers * 2 > shard->slotCount && growShard(shard) != 0) {
+        printf("❌ User table is full!\n");
+    }
+    return user;
+}
+
+// Make room for one more element of a growable array
+int reserveOne(void **items, int count, int *capacity, size_t size) {
+    if (count < *capacity) return 0;
+    int newCapacity = *capacity > 0 ? *capacity * 2 : 8;
+    void *grown = realloc(*items, (size_t)newCapacity * size);
+    if (grown == NULL) return -1;
+    *items = grown;
+    *capacity = newCapacity;
+    return 0;
+}
+
+// ================= OPERATIONS =================
+
+// Each operation locks only the user's shard
+// Returns 0 on success, -1 on error
+// Time Complexity: O(1) amortized
+int logMeal(UserStore *store, uint32_t userId, const char *name, int calories,
+            float protein, float carbs, int64_t loggedAt) {
+    Shard *shard = shardOf(store, userId);
+    int result = -1;
+    pthread_mutex_lock(&shard->lock);
+    UserRecord *user = findUser(shard, userId, 1);
+    if (user != NULL &&
+        reserveOne((void**)&user->meals, user->numMeals, &user->mealCapacity, sizeof(MealEntry)) == 0) {
+        MealEntry *meal = &user->meals[user->numMeals++];
+        meal->name = internString(&shard->names, name);
+        meal->calories = calories;
+        meal->protein = protein;
+        meal->carbs = carbs;
+        meal->loggedAt = loggedAt;
+        user->mealCalories += calories;
+        shard->operations++;
+        result = 0;
+    }
+    pthread_mutex_unlock(&shard->lock);
+    return result;
+}
+
+int pushSin(UserStore *store, uint32_t userId, const char *name, const char *icon, int calories,
+            int64_t eatenAt) {
+    Shard *shard = shardOf(store, userId);
+    int result = -1;
+    pthread_mutex_lock(&shard->lock);
+    UserRecord *user = findUser(shard, userId, 1);
+    if (user != NULL &&
+        reserveOne((void**)&user->sins, user->numSins, &user->sinCapacity, sizeof(SinEntry)) == 0) {
+        SinEntry *sin = &user->sins[user->numSins++];
+        sin->name = internString(&shard->names, name);
+        sin->icon = internString(&shard->names, icon);
+        sin->calories = calories;
+        sin->eatenAt = eatenAt;
+        user->sinCalories += calories;
+        shard->operations++;
+        result = 0;
+    }
+    pthread_mutex_unlock(&shard->lock);
+    return result;
+}
+
+// Returns the popped sin's calories, -1 if the user's stack is empty
+int popSin(UserStore *store, uint32_t userId) {
+    Shard *shard = shardOf(store, userId);
+    int calories = -1;
+    pthread_mutex_lock(&shard->lock);
+    UserRecord *user = findUser(shard, userId, 0);
+    if (user != NULL && user->numSins > 0) {
+        calories = user->sins[--user->numSins].calories;
+        user->sinCalories -= calories;
+        shard->operations++;
+    }
+    pthread_mutex_unlock(&shard->lock);
+    return calories;
+}
+
+// Returns 0 if the user exists, -1 otherwise
+int getUserSummary(UserStore *store, uint32_t userId, UserSummary *out) {
+    Shard *shard = shardOf(store, userId);
+    memset(out, 0, sizeof(UserSummary));
+    pthread_mutex_lock(&shard->lock);
+    UserRecord *user = findUser(shard, userId, 0);
+    if (user != NULL) {
+        out->meals = user->numMeals;
+        out->mealCalories = user->mealCalories;
+        out->sins = user->numSins;
+        out->sinCalories = user->sinCalories;
+        out->topSinCalories = user->numSins > 0 ? user->sins[user->numSins - 1].calories : 0;
+    }
+    pthread_mutex_unlock(&shard->lock);
+    return user != NULL ? 0 : -1;
+}
+
+// Whole-store totals (takes every shard lock in turn)
+void storeTotals(UserStore *store, long *users, long *meals, long *mealCalories, long *sins) {
+    *users = *meals = *mealCalories = *sins = 0;
+    for (int s = 0; s < store->numShards; s++) {
+        Shard *shard = &store->shards[s];
+        pthread_mutex_lock(&shard->lock);
+        *users += shard->numUsers;
+        for (uint32_t i = 0; i < shard->slotCount; i++) {
+            UserRecord *user = shard->slots[i];
+            if (user == NULL) continue;
+            *meals += user->numMeals;
+            *mealCalories += user->mealCalories;
+            *sins += user->numSins;
+        }
+        pthread_mutex_unlock(&shard->lock);
+    }
+}
+
+// ================= LOAD GENERATOR =================
+
+static const char *mealNames[] = { "Poha", "Dal Tadka", "Paneer Bhurji", "Oats Upma", "Egg Curry",
+                                   "Rajma Chawal", "Idli Sambar", "Chicken Salad" };
+static const char *sinNames[] = { "Pizza", "Burger with Fries", "Maggi", "Cola", "Samosa" };
+static const char *sinIcons[] = { "🍕", "🍔", "🍜", "🥤", "🥟" };
+
+typedef struct {
+    UserStore *store;
+    int thread;
+    long operations;
+    uint32_t numUsers;
+    uint32_t *latencies;     // ns per operation
+    long mealsLogged;        // what this thread expects the store to hold
+    long mealCalories;
+    long sinsPushed;
+    long sinsPopped;
+} LoadJob;
+
+static inline uint64_t nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// 60% logMeal, 25% pushSin, 10% popSin, 5% summary, on random users
+void* loadWorker(void *arg) {
+    LoadJob *job = (LoadJob*)arg;
+    uint64_t seed = 0x9E3779B97F4A7C15ull * (job->thread + 1);
+    UserSummary summary;
+    for (long i = 0; i < job->operations; i++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        uint32_t userId = (uint32_t)(seed >> 32) % job->numUsers;
+        int kind = (int)((seed >> 8) % 100);
+        int calories = 100 + (int)((seed >> 16) % 600);
+        int64_t when = 1700000000 + i;
+
+        uint64_t start = nowNs();
+        if (kind < 60) {
+            if (logMeal(job->store, userId, mealNames[seed % 8], calories, (float)(calories % 40),
+                        (float)(calories % 90), when) == 0) {
+                job->mealsLogged++;
+                job->mealCalories += calories;
+            }
+        } else if (kind < 85) {
+            if (pushSin(job->store, userId, sinNames[seed % 5], sinIcons[seed % 5], calories, when) == 0) {
+                job->sinsPushed++;
+            }
+        } else if (kind < 95) {
+            if (popSin(job->store, userId) >= 0) job->sinsPopped++;
+        } else {
+            getUserSummary(job->store, userId, &summary);
+        }
+        uint64_t elapsed = nowNs() - start;
+        job->latencies[i] = elapsed > UINT32_MAX ? UINT32_MAX : (uint32_t)elapsed;
+    }
+    return NULL;
+}
+
+int compareLatency(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+// Run numThreads workers against a fresh store with numShards shards and
+// print one result row
+// Returns 1 if the store's totals match what the workers did
+int runLoad(int numShards, int numThreads, long opsPerThread, uint32_t numUsers) {
+    UserStore store;
+    if (initUserStore(&store, numShards) != 0) return 0;
+
+    LoadJob jobs[MAX_THREADS];
+    pthread_t threads[MAX_THREADS];
+    uint32_t *latencies = (uint32_t*)malloc((size_t)numThreads * opsPerThread * sizeof(uint32_t));
+    for (int t = 0; t < numThreads; t++) {
+        memset(&jobs[t], 0, sizeof(LoadJob));
+        jobs[t].store = &store;
+        jobs[t].thread = t;
+        jobs[t].operations = opsPerThread;
+        jobs[t].numUsers = numUsers;
+        jobs[t].latencies = latencies + (size_t)t * opsPerThread;
+    }
+
+    uint64_t start = nowNs();
+    int started = 0;
+    for (int t = 1; t < numThreads; t++) {
+        if (pthread_create(&threads[started], NULL, loadWorker, &jobs[t]) == 0) started++;
+    }
+    loadWorker(&jobs[0]);  // calling thread works too
+    for (int t = 0; t < started; t++) pthread_join(threads[t], NULL);
+    double seconds = (nowNs() - start) / 1e9;
+    long totalOps = (long)(started + 1) * opsPerThread;
+
+    qsort(latencies, totalOps, sizeof(uint32_t), compareLatency);
+    uint32_t p50 = latencies[totalOps / 2];
+    uint32_t p99 = latencies[totalOps * 99 / 100];
+    uint32_t worst = latencies[totalOps - 1];
+
+    long expectedMeals = 0, expectedCalories = 0, expectedSins = 0;
+    for (int t = 0; t <= started; t++) {
+        expectedMeals += jobs[t].mealsLogged;
+        expectedCalories += jobs[t].mealCalories;
+        expectedSins += jobs[t].sinsPushed - jobs[t].sinsPopped;
+    }
+    long users, meals, mealCalories, sins;
+    storeTotals(&store, &users, &meals, &mealCalories, &sins);
+    int same = meals == expectedMeals && mealCalories == expectedCalories && sins == expectedSins;
+
+    printf("%6d %8d %12.0f %9u %9u %10u  %s\n", numShards, started + 1, totalOps / seconds,
+           p50, p99, worst, same ? "Yes" : "No");
+    free(latencies);
+    freeUserStore(&store);
+    return same;
+}
+
+int defaultThreads(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus < 1 ? 1 : cpus > MAX_THREADS ? MAX_THREADS : (int)cpus;
+}
+
+// One global lock (1 shard) vs lock striping, at 1, 2, 4, ... threads
+void benchmarkStore(long opsPerThread, uint32_t numUsers) {
+    int cpus = defaultThreads();
+    int maxThreads = cpus < 8 ? 8 : cpus;
+    if (maxThreads > MAX_THREADS) maxThreads = MAX_THREADS;
+    printf("=== BENCHMARK: %ld ops per thread on %u users (%d CPU(s)) ===\n", opsPerThread, numUsers, cpus);
+    printf("%6s %8s %12s %9s %9s %10s  %s\n", "Shards", "Threads", "ops/sec", "p50 ns", "p99 ns",
+           "max ns", "Same totals");
+    int same = 1;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        same &= runLoad(1, threads, opsPerThread, numUsers);
+        same &= runLoad(NUM_SHARDS, threads, opsPerThread, numUsers);
+    }
+    if (maxThreads < cpus) printf("(capped at %d threads)\n", maxThreads);
+    if (cpus < maxThreads) printf("(threads beyond %d CPU(s) are time-sliced, so latency tails grow)\n", cpus);
+    printf("Store totals match the operations performed: %s\n\n", same ? "Yes" : "No");
+}
+
+// Build: gcc -O2 -pthread user_store.c
+int main(void) {
+    printf("\n=== NutriPlan Multi-User Store (Sharded, Lock-Striped) ===\n\n");
+
+    UserStore store;
+    if (initUserStore(&store, NUM_SHARDS) != 0) return 1;
+    logMeal(&store, 1001, "Poha", 250, 6.0f, 40.0f, 1700000000);
+    logMeal(&store, 1001, "Dal Tadka", 320, 14.0f, 48.0f, 1700010000);
+    pushSin(&store, 1001, "Pizza", "🍕", 700, 1700020000);
+    logMeal(&store, 2002, "Egg Curry", 410, 26.0f, 12.0f, 1700000500);
+    pushSin(&store, 2002, "Cola", "🥤", 150, 1700003000);
+    pushSin(&store, 2002, "Samosa", "🥟", 260, 1700004000);
+    popSin(&store, 2002);
+
+    uint32_t ids[] = { 1001, 2002, 3003 };
+    for (int i = 0; i < 3; i++) {
+        UserSummary s;
+        if (getUserSummary(&store, ids[i], &s) != 0) {
+            printf("👤 User %u: no records\n", ids[i]);
+            continue;
+        }
+        printf("👤 User %u (shard %ld): %d meals, %ld kcal | %d sins, %ld kcal, top %d kcal\n",
+               ids[i], (long)(shardOf(&store, ids[i]) - store.shards), s.meals, s.mealCalories,
+               s.sins, s.sinCalories, s.topSinCalories);
+    }
+    printf("Shard size: %zu bytes (padded to whole %d-byte cache lines)\n\n", sizeof(Shard), CACHE_LINE);
+    freeUserStore(&store);
+
+    benchmarkStore(200000, 20000);
+
+    printf("=== Concurrent users, no global lock ===\n\n");
+    return 0;
+}